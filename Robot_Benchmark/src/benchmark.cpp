@@ -0,0 +1,84 @@
+#include <robotkinematics.h>
+#include <dhchain.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+	constexpr size_t Configurations = 1 << 16;
+	constexpr int Repetitions = 20;
+
+	std::vector<std::array<float, 6>> createConfigurations() {
+		std::mt19937 random{1337};
+		std::uniform_real_distribution<float> distribution{-3.f, 3.f};
+		std::vector<std::array<float, 6>> configurations(Configurations);
+		for (auto& angles : configurations) {
+			for (auto& angle : angles) {
+				angle = distribution(random);
+			}
+		}
+		return configurations;
+	}
+
+	void print(std::string_view name, double perConfiguration, float checksum) {
+		std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+			<< std::setw(8) << perConfiguration << " ns/configuration (checksum " << checksum << ")\n";
+	}
+
+	// Runs the function for all configurations and prints the time per configuration.
+	// The sum of the results is printed to keep the compiler from removing the work.
+	template <typename Function>
+	double run(std::string_view name, const std::vector<std::array<float, 6>>& configurations, Function&& function) {
+		float sum = 0;
+		auto best = std::chrono::duration<double, std::nano>::max();
+		for (int i = 0; i < Repetitions; ++i) {
+			auto start = std::chrono::steady_clock::now();
+			for (const auto& angles : configurations) {
+				sum += function(angles)[3][0];
+			}
+			best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start));
+		}
+		double perConfiguration = best.count() / configurations.size();
+		print(name, perConfiguration, sum);
+		return perConfiguration;
+	}
+
+}
+
+int main() {
+	auto configurations = createConfigurations();
+	robot::RobotKinematics kinematics;
+
+	double generic = run("RobotKinematics::getTcp", configurations, [&](const std::array<float, 6>& angles) {
+		return kinematics.getTcp(angles);
+	});
+	double fixed = run("DHChain<Irb140DH>::getTcp", configurations, [](const std::array<float, 6>& angles) {
+		return robot::DHChain<robot::Irb140DH>::getTcp(angles);
+	});
+	std::cout << "Speedup DHChain: " << generic / fixed << "x\n";
+
+	robot::JointBatch batch;
+	batch.resize(configurations.size());
+	for (size_t i = 0; i < configurations.size(); ++i) {
+		for (int joint = 0; joint < 6; ++joint) {
+			batch.angles[joint][i] = configurations[i][joint];
+		}
+	}
+	robot::PoseBatch poses;
+	auto best = std::chrono::duration<double, std::nano>::max();
+	for (int i = 0; i < Repetitions; ++i) {
+		auto start = std::chrono::steady_clock::now();
+		kinematics.getTcpBatch(batch, poses);
+		best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start));
+	}
+	double batched = best.count() / configurations.size();
+	print("RobotKinematics::getTcpBatch", batched, poses.position[0][0]);
+	std::cout << "Speedup getTcpBatch: " << generic / batched << "x\n";
+
+	return 0;
+}
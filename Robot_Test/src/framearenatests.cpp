@@ -0,0 +1,115 @@
+#include <allocationcounter.h>
+#include <framearena.h>
+#include <matrixstack.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+TEST(FrameArenaTest, allocate_alignedAndReleasedByReset) {
+	// Given.
+	robot::FrameArena arena{256};
+
+	// When.
+	auto bytes = arena.allocate<uint8_t>(3);
+	auto matrices = arena.allocate<glm::mat4>(2);
+
+	// Then.
+	EXPECT_EQ(3, bytes.size());
+	EXPECT_EQ(2, matrices.size());
+	EXPECT_EQ(0, reinterpret_cast<uintptr_t>(matrices.data()) % alignof(glm::mat4));
+	EXPECT_EQ(3 + 2 * sizeof(glm::mat4), arena.used());
+	arena.reset();
+	EXPECT_EQ(0, arena.used());
+}
+
+TEST(FrameArenaTest, reset_growsToFitTheLastFrame) {
+	// Given.
+	robot::FrameArena arena{64};
+	auto frame = [&] {
+		arena.reset();
+		for (int i = 0; i < 10; ++i) {
+			auto data = arena.allocate<float>(100);
+			data[0] = 1.f;
+			data[99] = 1.f;
+		}
+	};
+	frame();
+	arena.reset(); // Grows once, to the size of the frame.
+
+	// When.
+	robot::AllocationScope allocations;
+	frame();
+	frame();
+	auto count = allocations.get();
+
+	// Then.
+	EXPECT_GE(arena.capacity(), 10 * 100 * sizeof(float));
+	EXPECT_EQ(0, count.count);
+	EXPECT_EQ(0, count.bytes);
+}
+
+TEST(MatrixStackTest, pushPop_keepsAtLeastOneMatrix) {
+	// Given.
+	robot::MatrixStack matrices;
+	matrices.top() = glm::translate(glm::mat4{1.f}, glm::vec3{1.f, 2.f, 3.f});
+
+	// When.
+	matrices.push();
+	matrices.top() = glm::mat4{2.f};
+
+	// Then.
+	EXPECT_EQ(2, matrices.size());
+	EXPECT_TRUE(matrices.pop());
+	EXPECT_EQ(glm::vec4(1.f, 2.f, 3.f, 1.f), matrices.top()[3]);
+	EXPECT_FALSE(matrices.pop());
+	EXPECT_EQ(1, matrices.size());
+	matrices.reset();
+	EXPECT_EQ(glm::mat4{1.f}, matrices.top());
+}
+
+TEST(MatrixStackTest, push_throwsWhenFull) {
+	// Given.
+	robot::MatrixStack matrices;
+	for (size_t i = 1; i < robot::MatrixStack::Capacity; ++i) {
+		matrices.push();
+	}
+
+	// When/Then.
+	EXPECT_THROW(matrices.push(), std::length_error);
+}
+
+TEST(AllocationCounterTest, countsHeapAllocations) {
+	// Given.
+	robot::AllocationScope allocations;
+
+	// When.
+	auto data = std::make_unique<std::array<char, 100>>();
+
+	// Then.
+	EXPECT_EQ(1, allocations.get().count);
+	EXPECT_GE(allocations.get().bytes, 100);
+}
+
+TEST(AllocationCounterTest, countsAllocationsOfOtherThreads) {
+	// Given.
+	std::unique_ptr<std::array<char, 100>> data;
+	std::thread thread;
+	robot::AllocationScope allocations;
+
+	// When.
+	thread = std::thread{[&data]() {
+		data = std::make_unique<std::array<char, 100>>();
+	}};
+	thread.join();
+
+	// Then.
+	EXPECT_GE(allocations.get().count, 1);
+	EXPECT_GE(allocations.get().bytes, 100);
+}
@@ -0,0 +1,78 @@
+#include <allocationcounter.h>
+#include <frameworker.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+TEST(FrameWorkerTest, start_runsJobOnOtherThreadUntilWait) {
+	// Given.
+	std::atomic<bool> release = false;
+	std::thread::id jobThread;
+	int calls = 0;
+	robot::FrameWorker worker{[&] {
+		while (!release) {
+			std::this_thread::yield();
+		}
+		jobThread = std::this_thread::get_id();
+		++calls;
+	}};
+
+	// When.
+	worker.start();
+	bool startedWhileRunning = worker.isStarted();
+	release = true;
+	worker.wait();
+
+	// Then.
+	EXPECT_TRUE(startedWhileRunning);
+	EXPECT_FALSE(worker.isStarted());
+	EXPECT_NE(std::this_thread::get_id(), jobThread);
+	EXPECT_EQ(1, calls);
+}
+
+TEST(FrameWorkerTest, wait_rethrowsAndWorkerIsReusable) {
+	// Given.
+	int calls = 0;
+	robot::FrameWorker worker{[&] {
+		if (++calls == 1) {
+			throw std::runtime_error{"job"};
+		}
+	}};
+
+	// When.
+	worker.start();
+	EXPECT_THROW(worker.wait(), std::runtime_error);
+	worker.start();
+	worker.wait();
+	worker.wait(); // Not started, returns directly.
+
+	// Then.
+	EXPECT_EQ(2, calls);
+	EXPECT_THROW({ worker.start(); worker.start(); }, std::logic_error);
+	worker.wait();
+}
+
+TEST(FrameWorkerTest, startAndWait_noAllocations) {
+	// Given.
+	int calls = 0;
+	robot::FrameWorker worker{[&] {
+		++calls;
+	}};
+	worker.start();
+	worker.wait();
+
+	// When.
+	robot::AllocationScope allocations;
+	for (int i = 0; i < 100; ++i) {
+		worker.start();
+		worker.wait();
+	}
+	auto count = allocations.get();
+
+	// Then.
+	EXPECT_EQ(101, calls);
+	EXPECT_EQ(0, count.count);
+}
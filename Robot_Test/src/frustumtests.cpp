@@ -0,0 +1,61 @@
+#include <frustum.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+	// Camera at (0, 0, 5) looking at the origin.
+	robot::Frustum createFrustum() {
+		auto projection = glm::perspective(glm::radians(40.f), 1.f, 0.1f, 100.f);
+		auto view = glm::lookAt(glm::vec3{0.f, 0.f, 5.f}, glm::vec3{0.f}, glm::vec3{0.f, 1.f, 0.f});
+		return robot::Frustum::create(projection * view);
+	}
+
+}
+
+TEST(FrustumTest, isVisible_insideOutsideAndIntersecting) {
+	// Given.
+	auto frustum = createFrustum();
+
+	// When/Then.
+	EXPECT_TRUE(frustum.isVisible(glm::vec3{0.f}, 0.1f));
+	EXPECT_FALSE(frustum.isVisible(glm::vec3{0.f, 0.f, 10.f}, 1.f)); // Behind the camera.
+	EXPECT_FALSE(frustum.isVisible(glm::vec3{10.f, 0.f, 0.f}, 1.f));
+	EXPECT_TRUE(frustum.isVisible(glm::vec3{10.f, 0.f, 0.f}, 9.f));
+	EXPECT_FALSE(frustum.isVisible(glm::vec3{0.f, 0.f, -200.f}, 1.f)); // Beyond the far plane.
+}
+
+TEST(FrustumTest, sphereBatchCull_sameAsIsVisible) {
+	// Given.
+	auto frustum = createFrustum();
+	std::mt19937 random{1};
+	std::uniform_real_distribution<float> position{-20.f, 20.f};
+	std::uniform_real_distribution<float> radius{0.f, 2.f};
+	robot::SphereBatch batch;
+	std::vector<bool> expected;
+	for (int i = 0; i < 1003; ++i) { // Not a multiple of the lanes.
+		glm::vec3 center{position(random), position(random), position(random)};
+		float r = radius(random);
+		batch.add(center, r);
+		expected.push_back(frustum.isVisible(center, r));
+	}
+	std::vector<uint8_t> visible(batch.size());
+
+	// When.
+	size_t count = batch.cull(frustum, visible);
+
+	// Then.
+	size_t expectedCount = 0;
+	for (size_t i = 0; i < expected.size(); ++i) {
+		EXPECT_EQ(expected[i], visible[i] == 1) << "sphere " << i;
+		expectedCount += expected[i] ? 1 : 0;
+	}
+	EXPECT_EQ(expectedCount, count);
+	EXPECT_GT(count, 0);
+	EXPECT_LT(count, expected.size());
+}
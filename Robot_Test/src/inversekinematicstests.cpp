@@ -0,0 +1,136 @@
+#include <inversekinematics.h>
+
+#include <gtest/gtest.h>
+#include <glm/gtc/constants.hpp>
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+	void expectNear(const glm::mat4& expected, const glm::mat4& actual, float tolerance = 1e-4f) {
+		for (int column = 0; column < 4; ++column) {
+			for (int row = 0; row < 4; ++row) {
+				EXPECT_NEAR(expected[column][row], actual[column][row], tolerance) << "column " << column << ", row " << row;
+			}
+		}
+	}
+
+	float jointMotion(const std::array<float, 6>& a, const std::array<float, 6>& b) {
+		float motion = 0;
+		for (int i = 0; i < 6; ++i) {
+			motion = std::max(motion, std::abs(a[i] - b[i]));
+		}
+		return motion;
+	}
+
+}
+
+class InverseKinematicsTest : public ::testing::Test {
+protected:
+	std::array<float, 6> randomAngles() {
+		// Away from the wrist singularity, i.e. angles[4] not close to 0 or Pi.
+		std::uniform_real_distribution<float> distribution{-3.f, 3.f};
+		std::uniform_real_distribution<float> wristDistribution{0.2f, 2.9f};
+		return {
+			distribution(random_),
+			distribution(random_),
+			distribution(random_),
+			distribution(random_),
+			wristDistribution(random_),
+			distribution(random_)
+		};
+	}
+
+	robot::InverseKinematics ik_;
+	std::mt19937 random_{1337};
+};
+
+TEST_F(InverseKinematicsTest, solve_allSolutionsReachTcp) {
+	for (int i = 0; i < 200; ++i) {
+		// Given.
+		auto tcp = ik_.getKinematics().getTcp(randomAngles());
+
+		// When.
+		auto solutions = ik_.solve(tcp);
+
+		// Then.
+		ASSERT_FALSE(solutions.empty());
+		for (const auto& angles : solutions) {
+			expectNear(tcp, ik_.getKinematics().getTcp(angles));
+		}
+	}
+}
+
+TEST_F(InverseKinematicsTest, solve_eightSolutionsInsideWorkspace) {
+	// Given.
+	auto tcp = ik_.getKinematics().getTcp({0.3f, 0.2f, 0.1f, 0.4f, 1.f, 0.5f});
+
+	// When.
+	auto solutions = ik_.solve(tcp);
+
+	// Then.
+	EXPECT_EQ(robot::IkSolutions::MaxSize, solutions.size);
+}
+
+TEST_F(InverseKinematicsTest, solve_unreachableTcpHasNoSolution) {
+	// Given.
+	glm::mat4 tcp{1.f};
+	tcp[3] = glm::vec4{3.f, 0.f, 0.f, 1.f};
+
+	// When.
+	auto solutions = ik_.solve(tcp);
+
+	// Then.
+	EXPECT_TRUE(solutions.empty());
+}
+
+TEST_F(InverseKinematicsTest, solve_wristSingularity) {
+	// Given. angles[4] = -Pi gives theta5 = 0.
+	auto tcp = ik_.getKinematics().getTcp({0.3f, 0.2f, 0.1f, 0.4f, -glm::pi<float>(), 0.5f});
+
+	// When.
+	auto solutions = ik_.solve(tcp);
+
+	// Then.
+	ASSERT_FALSE(solutions.empty());
+	for (const auto& angles : solutions) {
+		expectNear(tcp, ik_.getKinematics().getTcp(angles));
+	}
+}
+
+TEST_F(InverseKinematicsTest, solveClosest_returnsOriginalAngles) {
+	for (int i = 0; i < 100; ++i) {
+		// Given.
+		auto angles = randomAngles();
+
+		// When.
+		auto closest = ik_.solveClosest(ik_.getKinematics().getTcp(angles), angles);
+
+		// Then.
+		ASSERT_TRUE(closest);
+		EXPECT_LT(jointMotion(angles, *closest), 1e-2f);
+	}
+}
+
+TEST_F(InverseKinematicsTest, solveTrajectory_followsContinuousPath) {
+	// Given. A joint space path crossing the Pi boundary of joint 1.
+	constexpr size_t Size = 500;
+	std::vector<std::array<float, 6>> path(Size);
+	std::vector<glm::mat4> poses(Size);
+	for (size_t i = 0; i < Size; ++i) {
+		float t = static_cast<float>(i) / Size;
+		path[i] = {2.5f + 1.5f * t, 0.2f + 0.3f * t, 0.1f, 0.4f - t, 1.f + 0.5f * t, 0.5f + 4.f * t};
+		poses[i] = ik_.getKinematics().getTcp(path[i]);
+	}
+	std::vector<std::array<float, 6>> solutions(Size);
+
+	// When.
+	size_t solved = ik_.solveTrajectory(poses, path[0], solutions, 4);
+
+	// Then.
+	ASSERT_EQ(Size, solved);
+	for (size_t i = 0; i < Size; ++i) {
+		EXPECT_LT(jointMotion(path[i], solutions[i]), 1e-2f) << "pose " << i;
+	}
+}
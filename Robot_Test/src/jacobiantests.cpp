@@ -0,0 +1,72 @@
+#include <cartesianjog.h>
+#include <jacobian.h>
+#include <robotkinematics.h>
+
+#include <gtest/gtest.h>
+
+class JacobianTest : public ::testing::Test {
+protected:
+	robot::RobotKinematics kinematics_;
+	std::array<float, 6> angles_{0.3f, 0.2f, 0.1f, 0.4f, 1.f, 0.5f};
+};
+
+TEST_F(JacobianTest, computeJacobian_linearPartMatchesFiniteDifference) {
+	// Given.
+	constexpr float Step = 1e-3f;
+	auto jacobian = robot::computeJacobian(kinematics_.getFrames(angles_));
+	glm::vec3 tcp{kinematics_.getTcp(angles_)[3]};
+
+	for (int joint = 0; joint < 6; ++joint) {
+		// When.
+		auto angles = angles_;
+		angles[joint] += Step;
+		glm::vec3 moved{kinematics_.getTcp(angles)[3]};
+
+		// Then.
+		glm::vec3 derivative = (moved - tcp) / Step;
+		for (int row = 0; row < 3; ++row) {
+			EXPECT_NEAR(derivative[row], jacobian[row][joint], 1e-2f) << "joint " << joint << ", row " << row;
+		}
+	}
+}
+
+TEST_F(JacobianTest, solveDampedLeastSquares_reproducesTwistWithoutDamping) {
+	// Given.
+	auto jacobian = robot::computeJacobian(kinematics_.getFrames(angles_));
+	robot::Vector6 twist{0.1f, -0.2f, 0.05f, 0.3f, 0.f, -0.1f};
+
+	// When.
+	auto velocities = robot::solveDampedLeastSquares(jacobian, twist, 0.f);
+
+	// Then.
+	for (int row = 0; row < 6; ++row) {
+		float value = 0;
+		for (int joint = 0; joint < 6; ++joint) {
+			value += jacobian[row][joint] * velocities[joint];
+		}
+		EXPECT_NEAR(twist[row], value, 1e-3f);
+	}
+}
+
+TEST_F(JacobianTest, cartesianJog_movesTcpAlongTwist) {
+	// Given.
+	robot::CartesianJog jog{kinematics_};
+	auto angles = angles_;
+	auto start = kinematics_.getTcp(angles);
+
+	// When. 0.1 s at 1 kHz with 0.1 m/s along x of the base frame.
+	for (int i = 0; i < 100; ++i) {
+		jog.step(angles, robot::Twist{.linear = {0.1f, 0.f, 0.f}}, robot::JogFrame::Base, 0.001f);
+	}
+
+	// Then.
+	auto end = kinematics_.getTcp(angles);
+	EXPECT_NEAR(start[3][0] + 0.01f, end[3][0], 1e-3f);
+	EXPECT_NEAR(start[3][1], end[3][1], 1e-3f);
+	EXPECT_NEAR(start[3][2], end[3][2], 1e-3f);
+	for (int column = 0; column < 3; ++column) {
+		for (int row = 0; row < 3; ++row) {
+			EXPECT_NEAR(start[column][row], end[column][row], 1e-2f);
+		}
+	}
+}
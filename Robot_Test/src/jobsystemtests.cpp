@@ -0,0 +1,78 @@
+#include <allocationcounter.h>
+#include <jobsystem.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(JobSystemTest, parallelFor_callsEachIndexOnce) {
+	// Given.
+	robot::JobSystem jobs{3};
+	std::vector<std::atomic<int>> calls(1000);
+
+	// When.
+	for (int i = 0; i < 10; ++i) {
+		jobs.parallelFor(calls.size(), [&](size_t index) {
+			++calls[index];
+		});
+	}
+
+	// Then.
+	for (const auto& count : calls) {
+		EXPECT_EQ(10, count);
+	}
+}
+
+TEST(JobSystemTest, parallelFor_withoutWorkers) {
+	// Given.
+	robot::JobSystem jobs{0};
+	int sum = 0;
+
+	// When.
+	jobs.parallelFor(4, [&](size_t index) {
+		sum += static_cast<int>(index);
+	});
+
+	// Then.
+	EXPECT_EQ(0, jobs.getWorkerCount());
+	EXPECT_EQ(6, sum);
+}
+
+TEST(JobSystemTest, parallelFor_rethrowsAfterAllJobs) {
+	// Given.
+	robot::JobSystem jobs{2};
+	std::atomic<int> calls = 0;
+
+	// When/Then.
+	EXPECT_THROW(jobs.parallelFor(100, [&](size_t index) {
+		++calls;
+		if (index == 50) {
+			throw std::runtime_error{"job"};
+		}
+	}), std::runtime_error);
+	EXPECT_EQ(100, calls);
+	EXPECT_NO_THROW(jobs.parallelFor(2, [](size_t) {}));
+}
+
+TEST(JobSystemTest, parallelFor_allocatesNothing) {
+	// Given.
+	robot::JobSystem jobs{2};
+	std::atomic<size_t> sum = 0;
+	auto job = [&](size_t index) {
+		sum += index;
+	};
+	jobs.parallelFor(8, job);
+
+	// When.
+	robot::AllocationScope allocations;
+	for (int i = 0; i < 100; ++i) {
+		jobs.parallelFor(8, job);
+	}
+	auto count = allocations.get();
+
+	// Then.
+	EXPECT_EQ(0, count.count);
+	EXPECT_EQ(101 * 28, sum);
+}
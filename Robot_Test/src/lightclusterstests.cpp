@@ -0,0 +1,121 @@
+#include <allocationcounter.h>
+#include <lightclusters.h>
+
+#include <glm/geometric.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+	constexpr float Near = 0.1f;
+	constexpr float Far = 50.f;
+
+	// Camera at (0, -10, 3) looking at the origin, z up, as in RobotWindow.
+	glm::mat4 createView() {
+		return glm::lookAt(glm::vec3{0.f, -10.f, 3.f}, glm::vec3{0.f}, glm::vec3{0.f, 0.f, 1.f});
+	}
+
+	glm::mat4 createProjection() {
+		return glm::perspective(glm::radians(40.f), 16.f / 9.f, Near, Far);
+	}
+
+	std::vector<robot::LightSphere> createLights(int count) {
+		std::mt19937 random{1};
+		std::uniform_real_distribution<float> position{-15.f, 15.f};
+		std::uniform_real_distribution<float> radius{0.5f, 4.f};
+		std::vector<robot::LightSphere> lights;
+		for (int i = 0; i < count; ++i) {
+			lights.push_back(robot::LightSphere{
+				.position = {position(random), position(random), position(random)},
+				.radius = radius(random)
+			});
+		}
+		return lights;
+	}
+
+	bool contains(std::span<const uint32_t> indices, uint32_t light) {
+		return std::find(indices.begin(), indices.end(), light) != indices.end();
+	}
+
+}
+
+TEST(LightClustersTest, update_clusterOfPointHasEveryLightReachingIt) {
+	// Given.
+	const auto view = createView();
+	const auto projection = createProjection();
+	const auto lights = createLights(60);
+	robot::LightClusters clusters;
+
+	// When.
+	clusters.update(view, projection, lights);
+
+	// Then.
+	std::mt19937 random{2};
+	std::uniform_real_distribution<float> ndc{-0.999f, 0.999f};
+	std::uniform_real_distribution<float> depth{std::log(Near), std::log(Far)};
+	const auto inverseView = glm::inverse(view);
+	int litPoints = 0;
+	for (int i = 0; i < 5000; ++i) {
+		// A point in the frustum, as the fragment shader finds its cluster.
+		const float x = ndc(random);
+		const float y = ndc(random);
+		const float d = std::exp(depth(random));
+		const glm::vec4 viewPoint{x * d / projection[0][0], y * d / projection[1][1], -d, 1.f};
+		const glm::vec3 point{inverseView * viewPoint};
+		const auto tileX = static_cast<uint32_t>((x + 1.f) * 0.5f * robot::LightClusters::TilesX);
+		const auto tileY = static_cast<uint32_t>((1.f - y) * 0.5f * robot::LightClusters::TilesY);
+		const auto cluster = clusters.getClusters()[robot::LightClusters::getIndex(tileX, tileY, clusters.getSlice(d))];
+		const auto indices = clusters.getLightIndices().subspan(cluster.offset, cluster.count);
+
+		for (uint32_t light = 0; light < lights.size(); ++light) {
+			if (glm::length(point - lights[light].position) <= lights[light].radius) {
+				EXPECT_TRUE(contains(indices, light)) << "point " << i << ", light " << light;
+				++litPoints;
+			}
+		}
+	}
+	EXPECT_GT(litPoints, 0);
+}
+
+TEST(LightClustersTest, update_lightsOnlyInTheClustersTheyReach) {
+	// Given.
+	robot::LightClusters clusters;
+	std::vector<robot::LightSphere> lights{
+		{.position = {0.f, 0.f, 0.f}, .radius = 0.5f},	// At the view center.
+		{.position = {0.f, 20.f, 40.f}, .radius = 1.f}	// Above the top of the view.
+	};
+
+	// When.
+	clusters.update(createView(), createProjection(), lights);
+
+	// Then.
+	const auto indices = clusters.getLightIndices();
+	const auto firstLight = std::count(indices.begin(), indices.end(), 0u);
+	EXPECT_GT(firstLight, 0);
+	EXPECT_LT(firstLight, 20);
+	EXPECT_EQ(0, std::count(indices.begin(), indices.end(), 1u));
+	EXPECT_EQ(1u, clusters.getMaxCount());
+}
+
+TEST(LightClustersTest, update_noAllocationsForTheSameLights) {
+	// Given.
+	const auto view = createView();
+	const auto projection = createProjection();
+	const auto lights = createLights(60);
+	robot::LightClusters clusters;
+	clusters.update(view, projection, lights);
+
+	// When.
+	robot::AllocationScope allocations;
+	clusters.update(view, projection, lights);
+	auto count = allocations.get();
+
+	// Then.
+	EXPECT_EQ(0, count.count);
+}
@@ -0,0 +1,30 @@
+#include <meshcache.h>
+
+#include <gtest/gtest.h>
+
+TEST(MeshCacheTest, getLodLevel_increasesWithScreenRadius) {
+	// Given.
+	int previous = 0;
+
+	// When/Then.
+	EXPECT_EQ(0, robot::MeshCache::getLodLevel(0.f));
+	EXPECT_EQ(robot::MeshCache::LodCount - 1, robot::MeshCache::getLodLevel(10'000.f));
+	for (float radius = 1.f; radius < 10'000.f; radius *= 1.5f) {
+		const int level = robot::MeshCache::getLodLevel(radius);
+		ASSERT_GE(level, previous);
+		previous = level;
+	}
+}
+
+TEST(MeshCacheTest, getSphereLod_moreTrianglesForFinerLevel) {
+	// Given.
+	robot::MeshCache cache;
+
+	// When/Then.
+	for (int level = 1; level < robot::MeshCache::LodCount; ++level) {
+		EXPECT_LT(cache.getSphereLod(level - 1).indices.size(), cache.getSphereLod(level).indices.size());
+		EXPECT_LT(cache.getCylinderLod(level - 1).indices.size(), cache.getCylinderLod(level).indices.size());
+	}
+	// Cached, the same mesh is returned.
+	EXPECT_EQ(&cache.getSphereLod(2), &cache.getSphereLod(2));
+}
@@ -0,0 +1,234 @@
+#include <meshfile.h>
+#include <meshimport.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+	std::filesystem::path createTemporaryPath(const std::string& name) {
+		return std::filesystem::temp_directory_path() / ("robot_test_" + name);
+	}
+
+	void writeFile(const std::filesystem::path& path, const std::string& data) {
+		std::ofstream out{path, std::ios::binary | std::ios::trunc};
+		out.write(data.data(), data.size());
+	}
+
+	// Unit cube made of 12 triangles, in binary STL format.
+	std::string createBinaryStlCube() {
+		const std::array<glm::vec3, 8> p{
+			glm::vec3{0, 0, 0}, glm::vec3{1, 0, 0}, glm::vec3{1, 1, 0}, glm::vec3{0, 1, 0},
+			glm::vec3{0, 0, 1}, glm::vec3{1, 0, 1}, glm::vec3{1, 1, 1}, glm::vec3{0, 1, 1}
+		};
+		const int faces[6][4] = {
+			{0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4},
+			{2, 3, 7, 6}, {1, 2, 6, 5}, {3, 0, 4, 7}
+		};
+
+		std::string data(80, ' ');
+		uint32_t count = 12;
+		data.append(reinterpret_cast<const char*>(&count), sizeof(count));
+		for (const auto& face : faces) {
+			for (const auto& triangle : {std::array{face[0], face[1], face[2]}, std::array{face[0], face[2], face[3]}}) {
+				float values[12] = {};
+				for (int k = 0; k < 3; ++k) {
+					values[3 + 3 * k] = p[triangle[k]].x;
+					values[4 + 3 * k] = p[triangle[k]].y;
+					values[5 + 3 * k] = p[triangle[k]].z;
+				}
+				data.append(reinterpret_cast<const char*>(values), sizeof(values));
+				data.append(2, '\0');
+			}
+		}
+		return data;
+	}
+
+	// Flat grid of size x size quads, with the triangles in random order.
+	robot::Mesh createShuffledGrid(int size) {
+		robot::Mesh mesh;
+		for (int y = 0; y <= size; ++y) {
+			for (int x = 0; x <= size; ++x) {
+				mesh.vertices.push_back(robot::MeshVertex{glm::vec3{static_cast<float>(x), static_cast<float>(y), 0.f}, glm::vec3{0, 0, 1}});
+			}
+		}
+		std::vector<std::array<uint32_t, 3>> triangles;
+		for (int y = 0; y < size; ++y) {
+			for (int x = 0; x < size; ++x) {
+				const uint32_t i = y * (size + 1) + x;
+				triangles.push_back({i, i + 1, i + size + 2});
+				triangles.push_back({i, i + size + 2, i + size + 1});
+			}
+		}
+		std::shuffle(triangles.begin(), triangles.end(), std::mt19937{1});
+		for (const auto& triangle : triangles) {
+			mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+		}
+		return mesh;
+	}
+
+	// The triangles as sorted vertex positions, independent of the vertex and triangle order.
+	std::vector<std::array<float, 3>> getSortedTriangles(const robot::Mesh& mesh) {
+		std::vector<std::array<float, 3>> triangles;
+		for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+			std::array<float, 3> triangle;
+			for (int k = 0; k < 3; ++k) {
+				const auto& position = mesh.vertices[mesh.indices[i + k]].position;
+				triangle[k] = position.x + 1000 * position.y;
+			}
+			std::sort(triangle.begin(), triangle.end());
+			triangles.push_back(triangle);
+		}
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+}
+
+TEST(MeshImportTest, importMesh_binaryStlCube_sharpEdgesSplit) {
+	// Given.
+	auto path = createTemporaryPath("cube.stl");
+	writeFile(path, createBinaryStlCube());
+
+	// When.
+	auto mesh = robot::importMesh(path);
+
+	// Then.
+	EXPECT_EQ(24, mesh.vertices.size()); // 4 corners for each side.
+	EXPECT_EQ(36, mesh.indices.size());
+	for (const auto& vertex : mesh.vertices) {
+		EXPECT_NEAR(1.f, std::abs(vertex.normal.x) + std::abs(vertex.normal.y) + std::abs(vertex.normal.z), 1e-6f);
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(MeshImportTest, importMesh_asciiStlQuad_welded) {
+	// Given.
+	auto path = createTemporaryPath("quad.stl");
+	writeFile(path,
+		"solid quad\n"
+		"facet normal 0 0 1\n outer loop\n  vertex 0 0 0\n  vertex 1 0 0\n  vertex 1 1 0\n endloop\nendfacet\n"
+		"facet normal 0 0 1\n outer loop\n  vertex 0 0 0\n  vertex 1 1 0\n  vertex 0 1 0\n endloop\nendfacet\n"
+		"endsolid quad\n"
+	);
+
+	// When.
+	auto mesh = robot::importMesh(path);
+
+	// Then.
+	EXPECT_EQ(4, mesh.vertices.size());
+	EXPECT_EQ(6, mesh.indices.size());
+	EXPECT_EQ(glm::vec3(0, 0, 1), mesh.vertices[0].normal);
+	std::filesystem::remove(path);
+}
+
+TEST(MeshImportTest, importMesh_objPolygon_triangulatedWithGivenNormals) {
+	// Given.
+	auto path = createTemporaryPath("quad.obj");
+	writeFile(path,
+		"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+		"vn 0 0 1\n"
+		"f 1//1 2//1 3//1 -1//-1\n"
+	);
+
+	// When.
+	auto mesh = robot::importMesh(path);
+
+	// Then.
+	EXPECT_EQ(4, mesh.vertices.size());
+	EXPECT_EQ(6, mesh.indices.size());
+	for (const auto& vertex : mesh.vertices) {
+		EXPECT_EQ(glm::vec3(0, 0, 1), vertex.normal);
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(MeshImportTest, optimizeVertexCache_lowerAcmrSameTriangles) {
+	// Given.
+	auto mesh = createShuffledGrid(32);
+	const auto triangles = getSortedTriangles(mesh);
+	const float acmr = robot::computeAcmr(mesh.indices);
+
+	// When.
+	robot::optimizeVertexCache(mesh);
+
+	// Then.
+	EXPECT_LT(robot::computeAcmr(mesh.indices), 0.8f);
+	EXPECT_LT(robot::computeAcmr(mesh.indices), acmr);
+	EXPECT_EQ(triangles, getSortedTriangles(mesh));
+	// Vertices are in the order of first use.
+	uint32_t next = 0;
+	for (auto index : mesh.indices) {
+		ASSERT_LE(index, next);
+		next = std::max(next, index + 1);
+	}
+}
+
+TEST(MeshFileTest, writeMeshFile_mappedWithoutChange) {
+	// Given.
+	auto path = createTemporaryPath("grid.rbmesh");
+	auto mesh = createShuffledGrid(4);
+
+	// When.
+	robot::writeMeshFile(path, mesh);
+	{
+		robot::MeshFile file{path};
+
+		// Then.
+		ASSERT_EQ(mesh.vertices.size(), file.vertices().size());
+		ASSERT_EQ(mesh.indices.size(), file.indices().size());
+		EXPECT_EQ(0, std::memcmp(mesh.vertices.data(), file.vertices().data(), file.vertices().size_bytes()));
+		EXPECT_TRUE(std::equal(mesh.indices.begin(), mesh.indices.end(), file.indices().begin()));
+		EXPECT_EQ(glm::vec3(0, 0, 0), file.getHeader().min);
+		EXPECT_EQ(glm::vec3(4, 4, 0), file.getHeader().max);
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(MeshFileTest, meshFile_truncatedFile_throws) {
+	// Given.
+	auto path = createTemporaryPath("truncated.rbmesh");
+	robot::writeMeshFile(path, createShuffledGrid(2));
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+	// When/Then.
+	EXPECT_THROW(robot::MeshFile{path}, std::runtime_error);
+	std::filesystem::remove(path);
+}
+
+TEST(MeshFileTest, meshFile_indexOutOfRange_throws) {
+	// Given.
+	auto path = createTemporaryPath("outofrange.rbmesh");
+	auto mesh = createShuffledGrid(2);
+	mesh.indices.back() = static_cast<uint32_t>(mesh.vertices.size());
+	robot::writeMeshFile(path, mesh);
+
+	// When/Then.
+	EXPECT_THROW(robot::MeshFile{path}, std::runtime_error);
+	std::filesystem::remove(path);
+}
+
+TEST(MeshImportTest, findMeshSource_modelBeforeMeshFile) {
+	// Given.
+	auto path = createTemporaryPath("source");
+	auto obj = createTemporaryPath("source.obj");
+	auto meshFile = createTemporaryPath("source.rbmesh");
+	writeFile(meshFile, "");
+
+	// When/Then.
+	EXPECT_EQ(meshFile, robot::findMeshSource(path));
+	writeFile(obj, "");
+	EXPECT_EQ(obj, robot::findMeshSource(path));
+	EXPECT_TRUE(robot::findMeshSource(createTemporaryPath("missing")).empty());
+	std::filesystem::remove(obj);
+	std::filesystem::remove(meshFile);
+}
@@ -0,0 +1,101 @@
+#include <ringallocator.h>
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST(RingAllocatorTest, allocate_alignedAndFreedWhenRetired) {
+	// Given.
+	robot::RingAllocator ring{256};
+
+	// When.
+	const size_t first = ring.allocate(10);
+	const size_t second = ring.allocate(100);
+	ring.endFrame();
+
+	// Then.
+	EXPECT_EQ(0, first);
+	EXPECT_EQ(16, second);
+	EXPECT_EQ(116, ring.used());
+	EXPECT_EQ(1, ring.framesInFlight());
+	ring.retireFrame();
+	EXPECT_EQ(0, ring.used());
+	EXPECT_EQ(0, ring.framesInFlight());
+}
+
+TEST(RingAllocatorTest, allocate_noSpaceUntilOldestFrameRetired) {
+	// Given.
+	robot::RingAllocator ring{256};
+	ring.allocate(128);
+	ring.endFrame();
+	ring.allocate(96);
+	ring.endFrame();
+
+	// When/Then.
+	EXPECT_EQ(robot::RingAllocator::NoSpace, ring.allocate(64)); // 32 left at the end.
+	ring.retireFrame();
+	EXPECT_EQ(0, ring.allocate(64)); // Wraps.
+	EXPECT_EQ(robot::RingAllocator::NoSpace, ring.allocate(128));
+	ring.endFrame();
+	ring.retireFrame();
+	ring.retireFrame();
+	EXPECT_EQ(0, ring.used());
+	EXPECT_EQ(robot::RingAllocator::NoSpace, ring.allocate(257));
+	EXPECT_THROW(ring.retireFrame(), std::logic_error);
+}
+
+TEST(RingAllocatorTest, allocate_neverOverlapsFramesInFlight) {
+	// Given.
+	robot::RingAllocator ring{1000};
+	std::mt19937 random{7};
+	std::uniform_int_distribution<size_t> size{1, 150}; // A frame always fits, with the skipped end.
+	std::uniform_int_distribution<int> allocations{0, 4};
+	std::deque<std::vector<std::pair<size_t, size_t>>> frames; // Ranges in flight.
+	std::vector<std::pair<size_t, size_t>> current;
+	auto overlaps = [&](size_t offset, size_t n) {
+		auto overlap = [&](const std::pair<size_t, size_t>& range) {
+			return offset < range.first + range.second && range.first < offset + n;
+		};
+		for (const auto& frame : frames) {
+			for (const auto& range : frame) {
+				if (overlap(range)) {
+					return true;
+				}
+			}
+		}
+		for (const auto& range : current) {
+			if (overlap(range)) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// When/Then.
+	for (int frame = 0; frame < 2000; ++frame) {
+		for (int i = allocations(random); i > 0; --i) {
+			const size_t n = size(random);
+			size_t offset = ring.allocate(n);
+			while (offset == robot::RingAllocator::NoSpace && !frames.empty()) {
+				ring.retireFrame();
+				frames.pop_front();
+				offset = ring.allocate(n);
+			}
+			ASSERT_NE(robot::RingAllocator::NoSpace, offset);
+			ASSERT_LE(offset + n, ring.capacity());
+			ASSERT_FALSE(overlaps(offset, n)) << "frame " << frame;
+			current.emplace_back(offset, n);
+		}
+		if (frames.size() == 3) {
+			ring.retireFrame();
+			frames.pop_front();
+		}
+		ring.endFrame();
+		frames.push_back(std::move(current));
+		current.clear();
+	}
+}
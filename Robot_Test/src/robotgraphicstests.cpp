@@ -0,0 +1,105 @@
+#include <allocationcounter.h>
+#include <graphic.h>
+#include <robotgraphics.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace {
+
+	// The geometry of RobotWindow::buildFrame without the GPU, the robot in one builder and
+	// the light bulbs in the other.
+	class HeadlessScene {
+	public:
+		HeadlessScene() {
+			robot_.setWorkspace(-100, -100, -100, 100, 100, 100, glm::mat4{1.f});
+		}
+
+		robot::RobotGraphics& getRobot() {
+			return robot_;
+		}
+
+		void build(int frame) {
+			robotBuilder_.clear();
+			lightBuilder_.clear();
+
+			const std::array<float, 6> angles{0.01f * frame, 0.2f, 0.3f, 0.f, 0.5f, 0.f};
+			robot_.draw(robotBuilder_, angles);
+			robot_.drawWorkspace(robotBuilder_);
+
+			// As RobotWindow::drawLights.
+			for (const auto& position : LightPositions) {
+				lightBuilder_.loadIdentityMatrix();
+				lightBuilder_.translate(position);
+				lightBuilder_.addSolidSphere(0.1f, sdl::color::White, robot::DrawMode::NoLight);
+			}
+		}
+
+	private:
+		static constexpr std::array<glm::vec3, 2> LightPositions{glm::vec3{1.f, 1.f, 2.f}, glm::vec3{-1.f, 0.5f, 1.5f}};
+
+		robot::FrameCamera camera_ = robot::FrameCamera::create(
+			glm::perspective(glm::radians(40.f), 16.f / 9.f, 0.1f, 100.f),
+			glm::lookAt(glm::vec3{2.f, 2.f, 1.5f}, glm::vec3{0.f, 0.f, 0.7f}, glm::vec3{0.f, 0.f, 1.f}),
+			1280, 720, true);
+		robot::MeshCache meshCache_;
+		robot::GeometryBuilder robotBuilder_{camera_, meshCache_};
+		robot::GeometryBuilder lightBuilder_{camera_, meshCache_};
+		robot::RobotGraphics robot_;
+	};
+
+	robot::AllocationCount countSteadyStateAllocations(HeadlessScene& scene) {
+		// Warm-up, the containers grow and the static geometry is recorded, once.
+		scene.build(0);
+		scene.build(1);
+
+		robot::AllocationScope allocations;
+		for (int frame = 2; frame < 50; ++frame) {
+			scene.build(frame);
+		}
+		return allocations.get();
+	}
+
+}
+
+TEST(RobotGraphicsTest, draw_steadyState_allocatesNothing) {
+	// Given.
+	HeadlessScene scene;
+	scene.getRobot().setSkinning(false);
+
+	// When.
+	auto count = countSteadyStateAllocations(scene);
+
+	// Then.
+	EXPECT_EQ(0, count.count);
+	EXPECT_EQ(0, count.bytes);
+}
+
+TEST(RobotGraphicsTest, drawSkinned_steadyState_allocatesNothing) {
+	// Given.
+	HeadlessScene scene;
+	scene.getRobot().setSkinning(true);
+
+	// When.
+	auto count = countSteadyStateAllocations(scene);
+
+	// Then.
+	EXPECT_EQ(0, count.count);
+	EXPECT_EQ(0, count.bytes);
+}
+
+TEST(RobotGraphicsTest, drawImpostors_steadyState_allocatesNothing) {
+	// Given.
+	HeadlessScene scene;
+	scene.getRobot().setImpostors(true);
+
+	// When.
+	auto count = countSteadyStateAllocations(scene);
+
+	// Then.
+	EXPECT_EQ(0, count.count);
+	EXPECT_EQ(0, count.bytes);
+}
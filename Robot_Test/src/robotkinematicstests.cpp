@@ -0,0 +1,153 @@
+#include <robotkinematics.h>
+#include <dhchain.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace {
+
+	void expectNear(const glm::mat4& expected, const glm::mat4& actual, float tolerance = 1e-5f) {
+		for (int column = 0; column < 4; ++column) {
+			for (int row = 0; row < 4; ++row) {
+				EXPECT_NEAR(expected[column][row], actual[column][row], tolerance) << "column " << column << ", row " << row;
+			}
+		}
+	}
+
+	std::array<float, 6> randomAngles(std::mt19937& random) {
+		std::uniform_real_distribution<float> distribution{-3.f, 3.f};
+		std::array<float, 6> angles;
+		for (auto& angle : angles) {
+			angle = distribution(random);
+		}
+		return angles;
+	}
+
+}
+
+class RobotKinematicsTest : public ::testing::Test {
+protected:
+	robot::RobotKinematics kinematics_;
+	std::mt19937 random_{1337};
+};
+
+TEST_F(RobotKinematicsTest, getFrames_baseFrameIsIdentity) {
+	// When.
+	auto frames = kinematics_.getFrames(randomAngles(random_));
+
+	// Then.
+	expectNear(glm::mat4{1.f}, frames[0]);
+}
+
+TEST_F(RobotKinematicsTest, getFrames_isProductOfH) {
+	// Given.
+	auto angles = randomAngles(random_);
+	auto thetas = robot::convertAngles(angles);
+
+	// When.
+	auto frames = kinematics_.getFrames(angles);
+
+	// Then.
+	glm::mat4 h{1.f};
+	for (int n = 0; n < 6; ++n) {
+		h = h * kinematics_.getH(thetas[n], n);
+		expectNear(h, frames[n + 1]);
+	}
+}
+
+TEST_F(RobotKinematicsTest, getTcpBatch_sameAsScalar) {
+	// Given. Not a multiple of the internal block size.
+	constexpr size_t Size = 1000;
+	robot::JointBatch batch;
+	batch.resize(Size);
+	std::vector<std::array<float, 6>> configurations(Size);
+	for (size_t i = 0; i < Size; ++i) {
+		configurations[i] = randomAngles(random_);
+		for (int joint = 0; joint < 6; ++joint) {
+			batch.angles[joint][i] = configurations[i][joint];
+		}
+	}
+	robot::PoseBatch poses;
+
+	// When.
+	kinematics_.getTcpBatch(batch, poses);
+
+	// Then.
+	ASSERT_EQ(Size, poses.size());
+	for (size_t i = 0; i < Size; ++i) {
+		expectNear(kinematics_.getTcp(configurations[i]), poses.getPose(i));
+	}
+}
+
+TEST_F(RobotKinematicsTest, kinematicsCache_sameAsGetFrames) {
+	// Given.
+	robot::KinematicsCache cache{kinematics_};
+	auto angles = randomAngles(random_);
+
+	// When.
+	int first = cache.update(angles);
+
+	// Then.
+	EXPECT_EQ(0, first);
+	auto frames = kinematics_.getFrames(angles);
+	for (size_t i = 0; i < frames.size(); ++i) {
+		expectNear(frames[i], cache.getFrames()[i]);
+	}
+}
+
+TEST_F(RobotKinematicsTest, kinematicsCache_recomputesFromFirstChangedJoint) {
+	// Given.
+	robot::KinematicsCache cache{kinematics_};
+	auto angles = randomAngles(random_);
+	cache.update(angles);
+
+	// When.
+	int unchanged = cache.update(angles);
+	angles[4] += 0.1f;
+	int wristChanged = cache.update(angles);
+	angles[1] += 0.1f;
+	int shoulderChanged = cache.update(angles);
+
+	// Then.
+	EXPECT_EQ(6, unchanged);
+	EXPECT_EQ(4, wristChanged);
+	EXPECT_EQ(1, shoulderChanged);
+	auto frames = kinematics_.getFrames(angles);
+	for (size_t i = 0; i < frames.size(); ++i) {
+		expectNear(frames[i], cache.getFrames()[i]);
+	}
+}
+
+TEST_F(RobotKinematicsTest, dhChain_irb140SameAsDefaultDH) {
+	// Given.
+	auto dh = robot::createDefaultDH();
+
+	// Then.
+	for (int n = 0; n < 6; ++n) {
+		EXPECT_FLOAT_EQ(dh.a[n], robot::Irb140DH::a[n]);
+		EXPECT_FLOAT_EQ(dh.d[n], robot::Irb140DH::d[n]);
+		EXPECT_NEAR(std::cos(dh.alpha[n]), robot::Irb140DH::cosAlpha[n], 1e-6f);
+		EXPECT_NEAR(std::sin(dh.alpha[n]), robot::Irb140DH::sinAlpha[n], 1e-6f);
+	}
+}
+
+TEST_F(RobotKinematicsTest, dhChain_sameAsRuntimeChain) {
+	using Chain = robot::DHChain<robot::Irb140DH>;
+
+	for (int i = 0; i < 100; ++i) {
+		// Given.
+		auto angles = randomAngles(random_);
+
+		// When.
+		auto frames = Chain::getFrames(angles);
+		auto tcp = Chain::getTcp(angles);
+
+		// Then.
+		auto expectedFrames = kinematics_.getFrames(angles);
+		for (size_t j = 0; j < frames.size(); ++j) {
+			expectNear(expectedFrames[j], frames[j]);
+		}
+		expectNear(expectedFrames[6], tcp);
+	}
+}
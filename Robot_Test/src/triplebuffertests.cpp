@@ -0,0 +1,59 @@
+#include <triplebuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST(TripleBufferTest, update_noNewValue) {
+	// Given.
+	robot::TripleBuffer<int> buffer{7};
+
+	// When.
+	bool updated = buffer.update();
+
+	// Then.
+	EXPECT_FALSE(updated);
+	EXPECT_EQ(7, buffer.getReadBuffer());
+}
+
+TEST(TripleBufferTest, read_latestPublishedValue) {
+	// Given.
+	robot::TripleBuffer<int> buffer;
+
+	// When.
+	buffer.write(1);
+	buffer.write(2);
+	buffer.write(3);
+
+	// Then.
+	EXPECT_TRUE(buffer.update());
+	EXPECT_EQ(3, buffer.getReadBuffer());
+	EXPECT_FALSE(buffer.update());
+	EXPECT_EQ(3, buffer.getReadBuffer());
+}
+
+TEST(TripleBufferTest, read_neverTornOrOlder) {
+	// Given.
+	struct Value {
+		int first = 0;
+		int second = 0;
+	};
+	robot::TripleBuffer<Value> buffer;
+	constexpr int Writes = 200'000;
+
+	// When.
+	std::jthread writer{[&]() {
+		for (int i = 1; i <= Writes; ++i) {
+			buffer.write(Value{i, -i});
+		}
+	}};
+
+	// Then.
+	int last = 0;
+	while (last < Writes) {
+		const auto& value = buffer.read();
+		ASSERT_EQ(value.first, -value.second);
+		ASSERT_GE(value.first, last);
+		last = value.first;
+	}
+}
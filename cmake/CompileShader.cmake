@@ -0,0 +1,50 @@
+# Compiles an HLSL shader to DXIL and SPIR-V with dxc and embeds both in a header,
+# named as the source with .hlsl replaced by .h, in the include path of the target.
+#
+# robot_compile_shader(<target>
+#	SOURCE <hlsl file>
+#	PROFILE <shader model, e.g. vs_6_0>
+#	NAME <symbol prefix, e.g. ShaderVs gives ShaderVsDxilBytes and ShaderVsSpirvBytes>
+#	[OUTPUT <header name>]
+#	[DEFINES <name[=value]>...]
+#	[DEPENDS <included files>...]
+# )
+
+find_package(directx-dxc CONFIG REQUIRED)
+
+set(ROBOT_EMBED_SHADER_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/EmbedShader.cmake)
+
+function(robot_compile_shader target)
+	cmake_parse_arguments(PARSE_ARGV 1 SHADER "" "SOURCE;PROFILE;NAME;OUTPUT" "DEFINES;DEPENDS")
+
+	get_filename_component(source ${SHADER_SOURCE} ABSOLUTE)
+	get_filename_component(sourceName ${SHADER_SOURCE} NAME)
+	if (NOT SHADER_OUTPUT)
+		get_filename_component(SHADER_OUTPUT ${SHADER_SOURCE} NAME_WLE)
+		set(SHADER_OUTPUT ${SHADER_OUTPUT}.h)
+	endif ()
+
+	set(directory ${CMAKE_CURRENT_BINARY_DIR}/shaders)
+	set(header ${directory}/${SHADER_OUTPUT})
+	set(dxil ${directory}/${SHADER_OUTPUT}.dxil)
+	set(spirv ${directory}/${SHADER_OUTPUT}.spv)
+
+	set(defines)
+	foreach (define IN LISTS SHADER_DEFINES)
+		list(APPEND defines -D ${define})
+	endforeach ()
+
+	add_custom_command(
+		OUTPUT ${header}
+		COMMAND ${CMAKE_COMMAND} -E make_directory ${directory}
+		COMMAND ${DIRECTX_DXC_TOOL} -nologo -T ${SHADER_PROFILE} -E main ${defines} -Fo ${dxil} ${source}
+		COMMAND ${DIRECTX_DXC_TOOL} -nologo -spirv -T ${SHADER_PROFILE} -E main ${defines} -Fo ${spirv} ${source}
+		COMMAND ${CMAKE_COMMAND} -DNAME=${SHADER_NAME} -DSOURCE=${sourceName} -DDXIL=${dxil} -DSPIRV=${spirv} -DOUTPUT=${header} -P ${ROBOT_EMBED_SHADER_SCRIPT}
+		MAIN_DEPENDENCY ${source}
+		DEPENDS ${SHADER_DEPENDS} ${ROBOT_EMBED_SHADER_SCRIPT}
+		COMMENT "Compiling shader ${sourceName} to ${SHADER_OUTPUT}"
+		VERBATIM
+	)
+	target_sources(${target} PRIVATE ${header})
+	target_include_directories(${target} PRIVATE ${directory})
+endfunction()
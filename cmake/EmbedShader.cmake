@@ -0,0 +1,33 @@
+# Writes the compiled DXIL and SPIR-V binaries of one shader to a C++ header.
+# Usage: cmake -DNAME=<symbol prefix> -DSOURCE=<hlsl file name> -DDXIL=<file> -DSPIRV=<file> -DOUTPUT=<header> -P EmbedShader.cmake
+
+function(embed_binary file variable result)
+	file(READ ${file} hex HEX)
+	string(LENGTH "${hex}" length)
+	math(EXPR size "${length} / 2")
+	string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+	# Break the lines after 16 bytes.
+	string(REPEAT "0x[0-9a-f][0-9a-f]," 16 line)
+	string(REGEX REPLACE "(${line})" "\\1\n\t\t" bytes "${bytes}")
+	set(${result} "\tconstexpr std::array<uint8_t, ${size}> ${variable}{\n\t\t${bytes}\n\t};\n" PARENT_SCOPE)
+endfunction()
+
+embed_binary(${DXIL} ${NAME}DxilBytes dxil)
+embed_binary(${SPIRV} ${NAME}SpirvBytes spirv)
+
+file(WRITE ${OUTPUT}.tmp
+"#pragma once
+
+// Generated from ${SOURCE} by EmbedShader.cmake. Do not edit manually.
+#include <cstdint>
+#include <array>
+
+namespace robot {
+
+${dxil}
+${spirv}
+}
+")
+# Only touch the header when the content changes, to avoid rebuilding the includers.
+file(COPY_FILE ${OUTPUT}.tmp ${OUTPUT} ONLY_IF_DIFFERENT)
+file(REMOVE ${OUTPUT}.tmp)
@@ -0,0 +1,54 @@
+#include "allocationcounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// The replacements are linked in together with getAllocationCount, the rest of the
+// standard forms (nothrow, arrays) forward to these.
+
+namespace {
+
+	// Process-wide, the geometry of a frame is built on several threads. Relaxed, only
+	// the totals are read. Constant initialized, operator new may run before main.
+	std::atomic<size_t> allocationCount{0};
+	std::atomic<size_t> allocationBytes{0};
+
+}
+
+void* operator new(std::size_t size) {
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	allocationBytes.fetch_add(size, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+		return memory;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+namespace robot {
+
+	AllocationCount getAllocationCount() {
+		return {allocationCount.load(std::memory_order_relaxed), allocationBytes.load(std::memory_order_relaxed)};
+	}
+
+}
@@ -0,0 +1,39 @@
+#ifndef ROBOT_ALLOCATIONCOUNTER_H
+#define ROBOT_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+namespace robot {
+
+	/// Heap allocations through the global operator new, which is replaced when
+	/// anything from this header is used.
+	struct AllocationCount {
+		size_t count = 0;
+		size_t bytes = 0;
+	};
+
+	/// Totals of all threads since the start of the process. Over-aligned allocations
+	/// are not counted.
+	AllocationCount getAllocationCount();
+
+	/// Counts the allocations made by all threads during its lifetime, e.g. one frame.
+	/// The frame is built on the frame worker and the job threads, not only the caller.
+	class AllocationScope {
+	public:
+		AllocationScope()
+			: start_{getAllocationCount()} {
+		}
+
+		/// Allocations since construction.
+		AllocationCount get() const {
+			const auto now = getAllocationCount();
+			return {now.count - start_.count, now.bytes - start_.bytes};
+		}
+
+	private:
+		AllocationCount start_;
+	};
+
+}
+
+#endif
@@ -0,0 +1,39 @@
+#include "cartesianjog.h"
+
+#include <glm/mat3x3.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace robot {
+
+	CartesianJog::CartesianJog(const RobotKinematics& kinematics)
+		: kinematicsCache_{kinematics} {
+	}
+
+	void CartesianJog::step(std::array<float, 6>& angles, const Twist& twist, JogFrame frame, float deltaSeconds) {
+		kinematicsCache_.update(angles);
+		const auto& frames = kinematicsCache_.getFrames();
+
+		glm::vec3 linear = twist.linear;
+		glm::vec3 angular = twist.angular;
+		if (frame == JogFrame::Tool) {
+			const glm::mat3 rotation{glm::vec3{frames[6][0]}, glm::vec3{frames[6][1]}, glm::vec3{frames[6][2]}};
+			linear = rotation * linear;
+			angular = rotation * angular;
+		}
+		const Vector6 baseTwist{linear.x, linear.y, linear.z, angular.x, angular.y, angular.z};
+
+		auto velocities = solveDampedLeastSquares(computeJacobian(frames), baseTwist, damping_);
+
+		float fastest = 0;
+		for (float velocity : velocities) {
+			fastest = std::max(fastest, std::abs(velocity));
+		}
+		const float scale = fastest > maxJointSpeed_ ? maxJointSpeed_ / fastest : 1.f;
+		for (int i = 0; i < 6; ++i) {
+			angles[i] += velocities[i] * scale * deltaSeconds;
+		}
+	}
+
+}
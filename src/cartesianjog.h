@@ -0,0 +1,57 @@
+#ifndef ROBOT_CARTESIANJOG_H
+#define ROBOT_CARTESIANJOG_H
+
+#include "jacobian.h"
+#include "robotkinematics.h"
+
+#include <glm/vec3.hpp>
+
+#include <array>
+
+namespace robot {
+
+	/// The frame in which a jog twist is expressed.
+	enum class JogFrame {
+		Base,
+		Tool
+	};
+
+	/// Cartesian velocity of the TCP, linear in m/s and angular in rad/s.
+	struct Twist {
+		glm::vec3 linear{0.f};
+		glm::vec3 angular{0.f};
+	};
+
+	/// Cartesian jogging of the TCP-frame using the geometric Jacobian and a damped least squares
+	/// velocity solver. Does not allocate and is meant to be stepped from a fixed-rate loop.
+	class CartesianJog {
+	public:
+		CartesianJog() = default;
+
+		explicit CartesianJog(const RobotKinematics& kinematics);
+
+		/// Moves the joint angles (convention of convertAngles) one time step with the twist.
+		void step(std::array<float, 6>& angles, const Twist& twist, JogFrame frame, float deltaSeconds);
+
+		void setDamping(float damping) {
+			damping_ = damping;
+		}
+
+		/// The joint velocities are scaled down uniformly to stay below the maximum speed (rad/s).
+		void setMaxJointSpeed(float maxJointSpeed) {
+			maxJointSpeed_ = maxJointSpeed;
+		}
+
+		const KinematicsCache& getKinematicsCache() const {
+			return kinematicsCache_;
+		}
+
+	private:
+		KinematicsCache kinematicsCache_;
+		float damping_ = 0.02f;
+		float maxJointSpeed_ = 2.f;
+	};
+
+}
+
+#endif
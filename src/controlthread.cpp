@@ -0,0 +1,135 @@
+#include "controlthread.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace robot {
+
+	namespace {
+
+		// The OS sleep is only accurate to around a millisecond on some platforms,
+		// the last part before the deadline is busy-waited.
+		constexpr auto SpinTime = std::chrono::microseconds{200};
+
+		constexpr int StatisticsWindow = 1000;
+
+		bool isZero(const Twist& twist) {
+			return twist.linear == glm::vec3{0.f} && twist.angular == glm::vec3{0.f};
+		}
+
+		void waitUntil(std::chrono::steady_clock::time_point deadline) {
+			std::this_thread::sleep_until(deadline - SpinTime);
+			while (std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::yield();
+			}
+		}
+
+		// Accumulates the period over a window, using Welford's algorithm for the variance.
+		class PeriodStatistics {
+		public:
+			void add(double period, double lateness) {
+				++count_;
+				const double delta = period - mean_;
+				mean_ += delta / count_;
+				m2_ += delta * (period - mean_);
+				min_ = std::min(min_, period);
+				max_ = std::max(max_, period);
+				maxLateness_ = std::max(maxLateness_, lateness);
+			}
+
+			int getCount() const {
+				return count_;
+			}
+
+			void writeTo(ControlStatistics& statistics) const {
+				statistics.meanPeriod = mean_;
+				statistics.minPeriod = min_;
+				statistics.maxPeriod = max_;
+				statistics.jitter = count_ > 1 ? std::sqrt(m2_ / (count_ - 1)) : 0;
+				statistics.maxLateness = maxLateness_;
+			}
+
+		private:
+			int count_ = 0;
+			double mean_ = 0;
+			double m2_ = 0;
+			double min_ = std::numeric_limits<double>::max();
+			double max_ = 0;
+			double maxLateness_ = 0;
+		};
+
+	}
+
+	ControlThread::ControlThread(std::chrono::nanoseconds period)
+		: period_{period} {
+	}
+
+	void ControlThread::start(const std::array<float, 6>& angles) {
+		states_.write(ControlState{.angles = angles});
+		thread_ = std::jthread{[this, angles](std::stop_token stopToken) {
+			run(stopToken, angles);
+		}};
+	}
+
+	void ControlThread::setTwist(const Twist& twist, JogFrame frame) {
+		command_.twist = twist;
+		command_.frame = frame;
+		commands_.write(command_);
+	}
+
+	void ControlThread::setAngles(const std::array<float, 6>& angles) {
+		command_.angles = angles;
+		++command_.anglesVersion;
+		commands_.write(command_);
+	}
+
+	void ControlThread::run(std::stop_token stopToken, std::array<float, 6> angles) {
+		using Microseconds = std::chrono::duration<double, std::micro>;
+		const float deltaSeconds = std::chrono::duration<float>(period_).count();
+
+		Command command;
+		ControlStatistics statistics;
+		PeriodStatistics window;
+		uint64_t tick = 0;
+
+		// Absolute deadlines, so the rate does not drift with the time spent in each step.
+		auto deadline = std::chrono::steady_clock::now();
+		auto lastWakeUp = deadline;
+		while (!stopToken.stop_requested()) {
+			deadline += period_;
+			waitUntil(deadline);
+			const auto wakeUp = std::chrono::steady_clock::now();
+
+			window.add(Microseconds(wakeUp - lastWakeUp).count(), Microseconds(wakeUp - deadline).count());
+			lastWakeUp = wakeUp;
+			if (wakeUp - deadline > period_) {
+				// Skip the missed periods instead of trying to catch up.
+				++statistics.overruns;
+				deadline = wakeUp;
+			}
+			if (window.getCount() == StatisticsWindow) {
+				window.writeTo(statistics);
+				window = PeriodStatistics{};
+			}
+
+			if (commands_.update()) {
+				const auto& newCommand = commands_.getReadBuffer();
+				if (newCommand.anglesVersion != command.anglesVersion) {
+					angles = newCommand.angles;
+				}
+				command = newCommand;
+			}
+			if (!isZero(command.twist)) {
+				cartesianJog_.step(angles, command.twist, command.frame, deltaSeconds);
+			}
+
+			auto& state = states_.getWriteBuffer();
+			state.angles = angles;
+			state.tick = ++tick;
+			state.statistics = statistics;
+			states_.publish();
+		}
+	}
+
+}
@@ -0,0 +1,78 @@
+#ifndef ROBOT_CONTROLTHREAD_H
+#define ROBOT_CONTROLTHREAD_H
+
+#include "cartesianjog.h"
+#include "triplebuffer.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace robot {
+
+	/// Statistics of the measured control period, in microseconds.
+	struct ControlStatistics {
+		double meanPeriod = 0;
+		double minPeriod = 0;
+		double maxPeriod = 0;
+		double jitter = 0;			// Standard deviation of the period.
+		double maxLateness = 0;		// Largest wake up time after the deadline.
+		uint64_t overruns = 0;		// Ticks where a whole period was missed, since start.
+	};
+
+	/// Snapshot of the control state published to the render thread.
+	struct ControlState {
+		std::array<float, 6> angles{};	// Radians, convention of convertAngles.
+		uint64_t tick = 0;
+		ControlStatistics statistics;	// Over the last completed statistics window.
+	};
+
+	/// Runs the joint state simulation and the Cartesian jog solver at a fixed period on its
+	/// own thread, independent of vsync and render cost. The thread owns the joint state.
+	/// Commands and snapshots are exchanged through lock-free triple buffers, a single thread
+	/// (the window thread) must call the public functions.
+	class ControlThread {
+	public:
+		explicit ControlThread(std::chrono::nanoseconds period = std::chrono::milliseconds{1});
+
+		/// Starts the control thread, stopped and joined in the destructor.
+		void start(const std::array<float, 6>& angles);
+
+		void setTwist(const Twist& twist, JogFrame frame);
+
+		/// Overrides the joint angles, e.g. when moved by the joint sliders.
+		void setAngles(const std::array<float, 6>& angles);
+
+		/// Returns the latest published snapshot.
+		const ControlState& getState() {
+			return states_.read();
+		}
+
+		std::chrono::nanoseconds getPeriod() const {
+			return period_;
+		}
+
+	private:
+		struct Command {
+			Twist twist;
+			JogFrame frame = JogFrame::Base;
+			std::array<float, 6> angles{};
+			uint32_t anglesVersion = 0;
+		};
+
+		void run(std::stop_token stopToken, std::array<float, 6> angles);
+
+		const std::chrono::nanoseconds period_;
+		CartesianJog cartesianJog_;
+
+		Command command_;
+		TripleBuffer<Command> commands_;
+		TripleBuffer<ControlState> states_;
+
+		std::jthread thread_;
+	};
+
+}
+
+#endif
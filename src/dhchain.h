@@ -0,0 +1,150 @@
+#ifndef ROBOT_DHCHAIN_H
+#define ROBOT_DHCHAIN_H
+
+#include "robotkinematics.h"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <utility>
+
+namespace robot {
+
+	/// The DH-parameters of the ABB IRB-140 known at compile time (in meter), same values as createDefaultDH.
+	/// The cosine and sine of alpha are given directly since std::cos is not constexpr.
+	struct Irb140DH {
+		static constexpr std::array<float, 6> a{0.070f, 0.360f, 0, 0, 0, 0};
+		static constexpr std::array<float, 6> d{0.352f, 0, 0, 0.380f, 0, 0.065f};
+		static constexpr std::array<float, 6> cosAlpha{0, 1, 0, 0, 0, 1};
+		static constexpr std::array<float, 6> sinAlpha{-1, 0, 1, 1, 1, 0};
+	};
+
+	template <typename DH>
+	concept DHTable = requires {
+		{ DH::a } -> std::convertible_to<std::array<float, 6>>;
+		{ DH::d } -> std::convertible_to<std::array<float, 6>>;
+		{ DH::cosAlpha } -> std::convertible_to<std::array<float, 6>>;
+		{ DH::sinAlpha } -> std::convertible_to<std::array<float, 6>>;
+	};
+
+	/// Forward kinematics for a DH-table known at compile time. The chain is fully
+	/// unrolled and all terms with a zero or unit parameter are removed at compile time,
+	/// which the compiler is not allowed to do itself for floats. RobotKinematics is
+	/// the runtime fallback for other tables.
+	template <DHTable DH>
+	class DHChain {
+	public:
+		/// Same as RobotKinematics::getH.
+		template <int N>
+		static glm::mat4 getH(float theta) {
+			Frame frame{
+				.x = {1, 0, 0},
+				.y = {0, 1, 0},
+				.z = {0, 0, 1},
+				.p = {0, 0, 0}
+			};
+			multiplyH<N>(frame, std::cos(theta), std::sin(theta));
+			return frame.toMatrix();
+		}
+
+		/// Same as RobotKinematics::getFrames.
+		static std::array<glm::mat4, 7> getFrames(const std::array<float, 6>& angles) {
+			auto thetas = convertAngles(angles);
+
+			std::array<glm::mat4, 7> frames;
+			Frame frame{
+				.x = {1, 0, 0},
+				.y = {0, 1, 0},
+				.z = {0, 0, 1},
+				.p = {0, 0, 0}
+			};
+			frames[0] = frame.toMatrix();
+			[&]<size_t... N>(std::index_sequence<N...>) {
+				((multiplyH<N>(frame, std::cos(thetas[N]), std::sin(thetas[N])), frames[N + 1] = frame.toMatrix()), ...);
+			}(std::make_index_sequence<6>{});
+			return frames;
+		}
+
+		/// Same as RobotKinematics::getTcp.
+		static glm::mat4 getTcp(const std::array<float, 6>& angles) {
+			auto thetas = convertAngles(angles);
+
+			Frame frame{
+				.x = {1, 0, 0},
+				.y = {0, 1, 0},
+				.z = {0, 0, 1},
+				.p = {0, 0, 0}
+			};
+			[&]<size_t... N>(std::index_sequence<N...>) {
+				(multiplyH<N>(frame, std::cos(thetas[N]), std::sin(thetas[N])), ...);
+			}(std::make_index_sequence<6>{});
+			return frame.toMatrix();
+		}
+
+	private:
+		// Affine transformation, the last row is always (0, 0, 0, 1).
+		struct Frame {
+			glm::vec3 x;
+			glm::vec3 y;
+			glm::vec3 z;
+			glm::vec3 p;
+
+			glm::mat4 toMatrix() const {
+				return glm::mat4{
+					x.x, x.y, x.z, 0,
+					y.x, y.y, y.z, 0,
+					z.x, z.y, z.z, 0,
+					p.x, p.y, p.z, 1
+				};
+			}
+		};
+
+		template <float Factor>
+		static glm::vec3 scale(const glm::vec3& v) {
+			if constexpr (Factor == 1) {
+				return v;
+			} else if constexpr (Factor == -1) {
+				return -v;
+			} else {
+				return Factor * v;
+			}
+		}
+
+		// frame = frame * getH(theta, N), see RobotKinematics::getH for the matrix.
+		template <int N>
+		static void multiplyH(Frame& frame, float ct, float st) {
+			constexpr float ca = DH::cosAlpha[N];
+			constexpr float sa = DH::sinAlpha[N];
+			constexpr float a = DH::a[N];
+			constexpr float d = DH::d[N];
+
+			const glm::vec3 x = ct * frame.x + st * frame.y;
+			const glm::vec3 y = ct * frame.y - st * frame.x;
+			if constexpr (d != 0) {
+				frame.p += d * frame.z;
+			}
+			if constexpr (a != 0) {
+				frame.p += a * x;
+			}
+			if constexpr (sa == 0) {
+				frame.z = scale<ca>(frame.z);
+				frame.y = scale<ca>(y);
+			} else if constexpr (ca == 0) {
+				const glm::vec3 z = frame.z;
+				frame.z = scale<-sa>(y);
+				frame.y = scale<sa>(z);
+			} else {
+				const glm::vec3 z = frame.z;
+				frame.z = scale<ca>(z) - scale<sa>(y);
+				frame.y = scale<ca>(y) + scale<sa>(z);
+			}
+			frame.x = x;
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,82 @@
+#include "lighting.hlsli"
+
+// Must match FloorUniforms in shader.h.
+cbuffer FloorData : register(b1, space3)
+{
+    float4x4 viewProjection;
+    float4x4 inverseViewProjection;
+    float4 color1;       // Checker cells
+    float4 color2;
+    float4 lineColor;    // Grid lines
+    float cellSize;      // Meters
+    float lineSpacing;   // Meters between the grid lines
+    float lineWidth;     // Pixels
+    float fadeDistance;  // Meters from the camera, transparent from here
+};
+
+struct FloorVSOutput
+{
+    float4 position : SV_Position;
+    float2 ndc      : TEXCOORD0;
+};
+
+struct PSOutput
+{
+    float4 color : SV_Target;
+    float depth  : SV_Depth;
+};
+
+// Checker of cells 1 x 1, box filtered over the footprint of the pixel so the cells
+// blend to the mean color in the distance instead of aliasing.
+float filteredChecker(float2 p)
+{
+    float2 w = max(fwidth(p), 1e-4);
+    float2 i = 2.0 * (abs(frac((p - 0.5 * w) * 0.5) - 0.5) - abs(frac((p + 0.5 * w) * 0.5) - 0.5)) / w;
+    return 0.5 - 0.5 * i.x * i.y;
+}
+
+// Coverage of the grid lines at the integers, lineWidth pixels wide.
+float gridLines(float2 p)
+{
+    float2 w = max(fwidth(p), 1e-4);
+    float2 distance = abs(frac(p - 0.5) - 0.5) / w; // Pixels to the nearest line.
+    float2 coverage = saturate(0.5 * lineWidth + 0.5 - distance);
+    // Lines closer than a few widths fade instead of aliasing into one color.
+    coverage *= saturate(1.0 / (w * lineWidth * 4.0));
+    return max(coverage.x, coverage.y);
+}
+
+// Ray through the pixel intersected with the plane z = 0.
+PSOutput main(FloorVSOutput input)
+{
+    float4 nearPoint = mul(inverseViewProjection, float4(input.ndc, -1.0, 1.0));
+    float4 farPoint = mul(inverseViewProjection, float4(input.ndc, 1.0, 1.0));
+    float3 origin = nearPoint.xyz / nearPoint.w;
+    float3 direction = farPoint.xyz / farPoint.w - origin;
+    float t = -origin.z / direction.z;
+    if (direction.z >= 0.0 || t <= 0.0)
+    {
+        discard; // Above the horizon.
+    }
+    float3 worldPos = origin + t * direction;
+
+    // Same depth as rasterized geometry, the floor beyond the far plane stays behind it.
+    float4 clip = mul(viewProjection, float4(worldPos, 1.0));
+    float depth = clip.z / clip.w;
+    if (depth < 0.0)
+    {
+        discard; // Clipped by the near plane like the other geometry.
+    }
+
+    float4 color = lerp(color1, color2, filteredChecker(worldPos.xy / cellSize));
+    color = lerp(color, lineColor, gridLines(worldPos.xy / lineSpacing) * lineColor.a);
+    float3 lighting = accumulateLighting(input.position.xy, worldPos, float3(0.0, 0.0, 1.0));
+
+    float distance = length(worldPos.xy - cameraPos.xy);
+    float fade = 1.0 - smoothstep(0.5 * fadeDistance, fadeDistance, distance);
+
+    PSOutput output;
+    output.color = float4(color.rgb * lighting, color.a * fade);
+    output.depth = min(depth, 0.99999994);
+    return output;
+}
@@ -0,0 +1,23 @@
+// One triangle covering the screen, the floor is computed per pixel in floor.ps.hlsl.
+
+struct VSInput
+{
+    uint vertexId : SV_VertexID;
+};
+
+struct FloorVSOutput
+{
+    float4 position : SV_Position;
+    float2 ndc      : TEXCOORD0;
+};
+
+FloorVSOutput main(VSInput input)
+{
+    // (-1, -1), (3, -1) and (-1, 3), the corners outside the screen are clipped.
+    float2 ndc = float2((input.vertexId << 1) & 2, input.vertexId & 2) * 2.0 - 1.0;
+
+    FloorVSOutput output;
+    output.position = float4(ndc, 0.0, 1.0);
+    output.ndc = ndc;
+    return output;
+}
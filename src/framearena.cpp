@@ -0,0 +1,38 @@
+#include "framearena.h"
+
+#include <algorithm>
+
+namespace robot {
+
+	FrameArena::FrameArena(size_t capacity)
+		: buffer_{std::make_unique<std::byte[]>(capacity)}
+		, capacity_{capacity} {
+	}
+
+	void FrameArena::reset() {
+		if (!overflow_.empty()) {
+			// Large enough for the last frame, the overflow blocks are not needed again.
+			capacity_ += overflowSize_;
+			buffer_ = std::make_unique<std::byte[]>(capacity_);
+			overflow_.clear();
+			overflowSize_ = 0;
+		}
+		offset_ = 0;
+		used_ = 0;
+	}
+
+	void* FrameArena::allocateBytes(size_t size, size_t alignment) {
+		// new[] of bytes is aligned for any fundamental type, the offset keeps the alignment.
+		const size_t offset = (offset_ + alignment - 1) / alignment * alignment;
+		used_ += size;
+		if (offset + size <= capacity_) {
+			offset_ = offset + size;
+			return buffer_.get() + offset;
+		}
+		const size_t blockSize = std::max(size, capacity_);
+		overflow_.push_back(std::make_unique<std::byte[]>(blockSize));
+		overflowSize_ += blockSize;
+		return overflow_.back().get();
+	}
+
+}
@@ -0,0 +1,61 @@
+#ifndef ROBOT_FRAMEARENA_H
+#define ROBOT_FRAMEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace robot {
+
+	/// Bump allocator for data that lives until the end of the frame. Memory is
+	/// released all at once by reset. When a frame needs more than the capacity,
+	/// extra blocks are allocated and at the next reset replaced by one block of the
+	/// total size, so after a few frames of the same size nothing is allocated.
+	class FrameArena {
+	public:
+		explicit FrameArena(size_t capacity = 64 * 1024);
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		/// Returns uninitialized memory, aligned for T, which is valid until reset.
+		template <typename T>
+		std::span<T> allocate(size_t count) {
+			static_assert(std::is_trivially_destructible_v<T>, "The arena never calls destructors");
+			static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+			if (count == 0) {
+				return {};
+			}
+			void* memory = allocateBytes(count * sizeof(T), alignof(T));
+			return {static_cast<T*>(memory), count};
+		}
+
+		/// Releases everything allocated since the last reset.
+		void reset();
+
+		size_t capacity() const {
+			return capacity_;
+		}
+
+		/// Bytes allocated since the last reset.
+		size_t used() const {
+			return used_;
+		}
+
+	private:
+		void* allocateBytes(size_t size, size_t alignment);
+
+		std::unique_ptr<std::byte[]> buffer_;
+		size_t capacity_ = 0;
+		size_t offset_ = 0;
+		size_t used_ = 0;
+		std::vector<std::unique_ptr<std::byte[]>> overflow_;
+		size_t overflowSize_ = 0;
+	};
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+#include "frameworker.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace robot {
+
+	FrameWorker::FrameWorker(std::function<void()> job)
+		: job_{std::move(job)}
+		, thread_{[this](std::stop_token stopToken) {
+			workerLoop(stopToken);
+		}} {
+	}
+
+	FrameWorker::~FrameWorker() {
+		std::unique_lock lock{mutex_};
+		condition_.wait(lock, [&] {
+			return !pending_;
+		});
+	}
+
+	void FrameWorker::start() {
+		{
+			std::lock_guard lock{mutex_};
+			if (started_) {
+				throw std::logic_error{"[FrameWorker] Started before waiting for the last job"};
+			}
+			started_ = true;
+			pending_ = true;
+		}
+		condition_.notify_all();
+	}
+
+	void FrameWorker::wait() {
+		std::unique_lock lock{mutex_};
+		if (!started_) {
+			return;
+		}
+		condition_.wait(lock, [&] {
+			return !pending_;
+		});
+		started_ = false;
+		if (exception_) {
+			std::rethrow_exception(std::exchange(exception_, nullptr));
+		}
+	}
+
+	void FrameWorker::workerLoop(std::stop_token stopToken) {
+		while (true) {
+			{
+				std::unique_lock lock{mutex_};
+				if (!condition_.wait(lock, stopToken, [&] {
+					return pending_;
+				})) {
+					return;
+				}
+			}
+
+			std::exception_ptr exception;
+			try {
+				job_();
+			} catch (...) {
+				exception = std::current_exception();
+			}
+
+			{
+				std::lock_guard lock{mutex_};
+				exception_ = exception;
+				pending_ = false;
+			}
+			condition_.notify_all();
+		}
+	}
+
+}
@@ -0,0 +1,54 @@
+#ifndef ROBOT_FRAMEWORKER_H
+#define ROBOT_FRAMEWORKER_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+namespace robot {
+
+	/// Runs one fixed job on its own thread, started and waited for once per frame, e.g.
+	/// building the next frame while the current one is rendered. Does not allocate per
+	/// start.
+	class FrameWorker {
+	public:
+		explicit FrameWorker(std::function<void()> job);
+
+		/// Waits for a started job.
+		~FrameWorker();
+
+		FrameWorker(const FrameWorker&) = delete;
+		FrameWorker& operator=(const FrameWorker&) = delete;
+
+		/// Starts the job on the worker thread, wait must be called before the next start.
+		void start();
+
+		/// Returns when the started job is done, directly if not started. Rethrows the
+		/// exception thrown by the job.
+		void wait();
+
+		/// Returns true if started and not yet waited for.
+		bool isStarted() const {
+			return started_;
+		}
+
+	private:
+		void workerLoop(std::stop_token stopToken);
+
+		std::function<void()> job_;
+
+		std::mutex mutex_;
+		std::condition_variable_any condition_;
+		bool started_ = false;
+		bool pending_ = false;	// Started and not done.
+		std::exception_ptr exception_;
+
+		std::jthread thread_;
+	};
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include "frustum.h"
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace robot {
+
+	Frustum Frustum::create(const glm::mat4& viewProjection) {
+		// Row i of the matrix, glm is column-major.
+		auto row = [&](int i) {
+			return glm::vec4{viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]};
+		};
+		const glm::vec4 x = row(0);
+		const glm::vec4 y = row(1);
+		const glm::vec4 z = row(2);
+		const glm::vec4 w = row(3);
+
+		// The near plane is for the clip space depth -w <= z, which contains the
+		// frustum for the depth 0 <= z as well.
+		Frustum frustum{
+			.planes = {w + x, w - x, w + y, w - y, w + z, w - z}
+		};
+		for (auto& plane : frustum.planes) {
+			plane = plane / glm::length(glm::vec3{plane});
+		}
+		return frustum;
+	}
+
+	bool Frustum::isVisible(const glm::vec3& center, float radius) const {
+		for (const auto& plane : planes) {
+			if (glm::dot(glm::vec3{plane}, center) + plane.w < -radius) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void SphereBatch::clear() {
+		x_.clear();
+		y_.clear();
+		z_.clear();
+		radius_.clear();
+		size_ = 0;
+	}
+
+	void SphereBatch::add(const glm::vec3& center, float radius) {
+		if (size_ % Lanes == 0) {
+			const size_t size = size_ + Lanes;
+			x_.resize(size);
+			y_.resize(size);
+			z_.resize(size);
+			radius_.resize(size);
+		}
+		x_[size_] = center.x;
+		y_[size_] = center.y;
+		z_[size_] = center.z;
+		radius_[size_] = radius;
+		++size_;
+	}
+
+	size_t SphereBatch::cull(const Frustum& frustum, std::span<uint8_t> visible) const {
+		size_t count = 0;
+		for (size_t offset = 0; offset < size_; offset += Lanes) {
+			const float* x = x_.data() + offset;
+			const float* y = y_.data() + offset;
+			const float* z = z_.data() + offset;
+			const float* radius = radius_.data() + offset;
+
+			// All lanes against one plane at a time, the lanes are independent and fill
+			// the SIMD registers. No early out, it is cheaper than the branches.
+			float distances[Lanes];
+			std::fill_n(distances, Lanes, std::numeric_limits<float>::max());
+			for (const auto& plane : frustum.planes) {
+				for (size_t i = 0; i < Lanes; ++i) {
+					const float distance = plane.x * x[i] + plane.y * y[i] + plane.z * z[i] + plane.w + radius[i];
+					distances[i] = std::min(distances[i], distance);
+				}
+			}
+
+			const size_t size = std::min(Lanes, size_ - offset);
+			for (size_t i = 0; i < size; ++i) {
+				visible[offset + i] = distances[i] >= 0 ? 1 : 0;
+				count += visible[offset + i];
+			}
+		}
+		return count;
+	}
+
+}
@@ -0,0 +1,56 @@
+#ifndef ROBOT_FRUSTUM_H
+#define ROBOT_FRUSTUM_H
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace robot {
+
+	/// The six planes of a view frustum, each as (normal, distance) with the normal
+	/// pointing inwards, i.e. dot(normal, p) + distance >= 0 for points p inside.
+	struct Frustum {
+		std::array<glm::vec4, 6> planes;
+
+		/// Extracts the planes from the projection * view matrix (Gribb and Hartmann).
+		/// The planes are in world space.
+		static Frustum create(const glm::mat4& viewProjection);
+
+		/// Tests one sphere, use cullSpheres for many spheres.
+		bool isVisible(const glm::vec3& center, float radius) const;
+	};
+
+	/// Bounding spheres in structure-of-arrays layout, padded with empty spheres to a
+	/// multiple of Lanes so the culling always works on whole groups.
+	class SphereBatch {
+	public:
+		static constexpr size_t Lanes = 8;
+
+		void clear();
+
+		void add(const glm::vec3& center, float radius);
+
+		size_t size() const {
+			return size_;
+		}
+
+		/// Sets visible[i] to 1 if sphere i intersects the frustum, otherwise 0.
+		/// Returns the number of visible spheres. visible must hold size() elements.
+		size_t cull(const Frustum& frustum, std::span<uint8_t> visible) const;
+
+	private:
+		std::vector<float> x_;
+		std::vector<float> y_;
+		std::vector<float> z_;
+		std::vector<float> radius_;
+		size_t size_ = 0;
+	};
+
+}
+
+#endif
@@ -1,7 +1,13 @@
 #ifndef ZOMBIE_GRAPHIC_H
 #define ZOMBIE_GRAPHIC_H
 
+#include "framearena.h"
+#include "frustum.h"
+#include "lightclusters.h"
+#include "matrixstack.h"
+#include "meshcache.h"
 #include "shader.h"
+#include "uploadring.h"
 
 #include <sdl/batch.h>
 #include <sdl/gpu.h>
@@ -13,9 +19,13 @@
 #include <glm/gtx/rotate_vector.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <concepts>
+#include <limits>
+#include <optional>
 #include <span>
-#include <stack>
+#include <unordered_map>
 
 namespace robot {
 
@@ -27,18 +37,67 @@ namespace robot {
 		return sdl::createSdlSurface(s);
 	}
 
+	/// Drawn blended after the opaque geometry, sorted back to front.
+	inline bool isTransparent(const glm::vec4& color) {
+		return color.a < 1.f;
+	}
+
 	// Can't be stored.
 	struct GpuData {
-		bool cycle = false;
 		std::span<const Vertex> vertices;
 		std::span<const uint32_t> indices;
 		SDL_GPUBuffer* indexBuffer;
 		SDL_GPUBuffer* vertexBuffer;
-		SDL_GPUTransferBuffer* vertexTransferBuffer;
-		SDL_GPUTransferBuffer* indexTransferBuffer;
 		SDL_GPUGraphicsPipeline* pipeline;
+		uint32_t transformOffset;	// Added to the transform index of the vertices.
+	};
+
+	/// Indices of uploaded triangles drawn in one call.
+	struct TriangleRange {
+		SDL_GPUGraphicsPipeline* pipeline;
+		SDL_GPUBuffer* vertexBuffer;
+		SDL_GPUBuffer* indexBuffer;
+		uint32_t transformOffset;	// Added to the transform index of the vertices.
+		Uint32 firstIndex;
+		Uint32 indexCount;
 	};
 
+	inline void uploadToGpuBuffer(SDL_GPUCopyPass* copyPass, SDL_GPUTransferBuffer* transferBuffer, SDL_GPUBuffer* buffer, size_t size, bool cycle) {
+		SDL_GPUTransferBufferLocation location{
+			.transfer_buffer = transferBuffer,
+			.offset = 0
+		};
+		SDL_GPUBufferRegion region{
+			.buffer = buffer,
+			.offset = 0,
+			.size = static_cast<Uint32>(size)
+		};
+		SDL_UploadToGPUBuffer(copyPass, &location, &region, cycle);
+	}
+
+	/// A transparent shape in a batch, drawn on its own and sorted back to front with the
+	/// transparent instances.
+	struct TransparentShape {
+		uint32_t firstIndex;
+		uint32_t indexCount = 0;	// Set when the batch is done, see finishTransparentShapes.
+		glm::vec3 positionSum{0.f};	// World space, or the recorded space of static geometry.
+		uint32_t vertexCount = 0;
+		uint32_t transformIndex = 0;	// Of static geometry, see setStaticTransformIndex.
+
+		glm::vec3 getCenter() const {
+			return positionSum / static_cast<float>(std::max(vertexCount, 1u));
+		}
+	};
+
+	/// Sets the index count of the shapes of one batch, each shape ends where the next begins.
+	inline void finishTransparentShapes(std::span<TransparentShape> shapes, size_t indexCount) {
+		auto end = static_cast<uint32_t>(indexCount);
+		for (auto it = shapes.rbegin(); it != shapes.rend(); ++it) {
+			it->indexCount = end - it->firstIndex;
+			end = it->firstIndex;
+		}
+	}
+
 	enum class DrawMode {
 		Light,
 		NoLight
@@ -47,71 +106,1318 @@ namespace robot {
 	class TrianglesBuffer {
 	public:
 
-		GpuData prepareGpuData(SDL_GPUDevice* gpuDevice, SDL_GPUGraphicsPipeline* pipeline) {
-			auto indices_ = batch_.indices();
-			auto vertices_ = batch_.vertices();
-			SDL_GPUBuffer* indexBuffer = indexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, indices_);
-			SDL_GPUBuffer* vertexBuffer = vertexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, vertices_);
-			SDL_GPUTransferBuffer* vertexTransferBuffer = vertexTransferBuffer_.get(gpuDevice, vertices_, true);
-			SDL_GPUTransferBuffer* indexTransferBuffer = indexTransferBuffer_.get(gpuDevice, indices_, true);
-			
-			return GpuData{
-				.cycle = true,
-				.vertices = vertices_,
-				.indices = indices_,
-				.indexBuffer = indexBuffer,
-				.vertexBuffer = vertexBuffer,
-				.vertexTransferBuffer = vertexTransferBuffer,
-				.indexTransferBuffer = indexTransferBuffer,
-				.pipeline = pipeline
-			};
-		}
+		GpuData upload(SDL_GPUDevice* gpuDevice, UploadRing& uploadRing, SDL_GPUGraphicsPipeline* pipeline, uint32_t transformOffset) {
+			auto indices_ = batch_.indices();
+			auto vertices_ = batch_.vertices();
+			SDL_GPUBuffer* indexBuffer = indexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, indices_);
+			SDL_GPUBuffer* vertexBuffer = vertexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, vertices_);
+			uploadRing.upload(vertices_, vertexBuffer, true);
+			uploadRing.upload(indices_, indexBuffer, true);
+
+			return GpuData{
+				.vertices = vertices_,
+				.indices = indices_,
+				.indexBuffer = indexBuffer,
+				.vertexBuffer = vertexBuffer,
+				.pipeline = pipeline,
+				.transformOffset = transformOffset
+			};
+		}
+
+		sdl::Batch<Vertex>& batch() {
+			return batch_;
+		}
+
+	private:
+		sdl::Buffer vertexBuffer_;
+		sdl::Buffer indexBuffer_;
+		sdl::Batch<Vertex> batch_;
+	};
+
+	/// Geometry recorded once with Graphic::beginStatic and kept in its own GPU buffers,
+	/// which are only uploaded again after the geometry is recorded again. All of it is
+	/// drawn with the shader variant of the flags, the flags of the added shapes are not used.
+	/// Transparent triangles are kept apart and drawn blended with the transparent geometry
+	/// of the frame, transparent lines are drawn opaque.
+	class StaticGeometry {
+	public:
+		explicit StaticGeometry(SDL_GPUPrimitiveType primitiveType = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, uint32_t flags = VertexFlag::None)
+			: primitiveType_{primitiveType}
+			, variant_{ShaderVariant::get(flags)} {
+		}
+
+		/// Marks the geometry to be recorded again.
+		void invalidate() {
+			dirty_ = true;
+		}
+
+		bool isDirty() const {
+			return dirty_;
+		}
+
+		SDL_GPUPrimitiveType getPrimitiveType() const {
+			return primitiveType_;
+		}
+
+		uint32_t getVariant() const {
+			return variant_;
+		}
+
+		sdl::Batch<Vertex>& batch() {
+			return batch_;
+		}
+
+		/// The batch of the shapes of the color.
+		sdl::Batch<Vertex>& batch(sdl::Color color) {
+			return isBlended(color) ? transparentBatch_ : batch_;
+		}
+
+		/// The shapes in the transparent batch, nullptr if the color is drawn opaque.
+		std::vector<TransparentShape>* getTransparentShapes(sdl::Color color) {
+			return isBlended(color) ? &transparentShapes_ : nullptr;
+		}
+
+		std::span<const TransparentShape> getTransparentShapes() const {
+			return transparentShapes_;
+		}
+
+		SDL_GPUBuffer* getTransparentVertexBuffer() const {
+			return transparentVertexGpuBuffer_;
+		}
+
+		SDL_GPUBuffer* getTransparentIndexBuffer() const {
+			return transparentIndexGpuBuffer_;
+		}
+
+		/// Called before the recording.
+		void clear() {
+			batch_.clear();
+			transparentBatch_.clear();
+			transparentShapes_.clear();
+		}
+
+		/// Called when the recording is done.
+		void finish() {
+			finishTransparentShapes(transparentShapes_, transparentBatch_.indices().size());
+			dirty_ = false;
+			uploaded_ = false;
+		}
+
+		void upload(SDL_GPUDevice* gpuDevice, UploadRing& uploadRing) {
+			if (uploaded_) {
+				return;
+			}
+			auto vertices = batch_.vertices();
+			auto indices = batch_.indices();
+			indexCount_ = static_cast<Uint32>(indices.size());
+			uploaded_ = true;
+			if (!indices.empty()) {
+				// Cycle since the buffers may still be used by a frame in flight.
+				vertexGpuBuffer_ = vertexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, vertices);
+				indexGpuBuffer_ = indexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, indices);
+				uploadRing.upload(vertices, vertexGpuBuffer_, true);
+				uploadRing.upload(indices, indexGpuBuffer_, true);
+			}
+			auto transparentVertices = transparentBatch_.vertices();
+			auto transparentIndices = transparentBatch_.indices();
+			if (!transparentIndices.empty()) {
+				transparentVertexGpuBuffer_ = transparentVertexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, transparentVertices);
+				transparentIndexGpuBuffer_ = transparentIndexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, transparentIndices);
+				uploadRing.upload(transparentVertices, transparentVertexGpuBuffer_, true);
+				uploadRing.upload(transparentIndices, transparentIndexGpuBuffer_, true);
+			}
+		}
+
+		void draw(SDL_GPURenderPass* renderPass) const {
+			if (indexCount_ == 0) {
+				return;
+			}
+			SDL_GPUBufferBinding vertexBinding{
+				.buffer = vertexGpuBuffer_,
+				.offset = 0
+			};
+			SDL_BindGPUVertexBuffers(
+				renderPass,
+				0,
+				&vertexBinding,
+				1
+			);
+
+			SDL_GPUBufferBinding indexBinding{
+				.buffer = indexGpuBuffer_,
+				.offset = 0
+			};
+			SDL_BindGPUIndexBuffer(
+				renderPass,
+				&indexBinding,
+				SDL_GPU_INDEXELEMENTSIZE_32BIT
+			);
+
+			SDL_DrawGPUIndexedPrimitives(
+				renderPass,
+				indexCount_,
+				1,
+				0,
+				0,
+				0
+			);
+		}
+
+	private:
+		// There is no blended line pipeline.
+		bool isBlended(sdl::Color color) const {
+			return isTransparent(color) && primitiveType_ == SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+		}
+
+		SDL_GPUPrimitiveType primitiveType_;
+		uint32_t variant_;
+		sdl::Batch<Vertex> batch_;
+		sdl::Batch<Vertex> transparentBatch_;
+		std::vector<TransparentShape> transparentShapes_;
+		bool dirty_ = true;
+		bool uploaded_ = false;
+		Uint32 indexCount_ = 0;
+
+		sdl::Buffer vertexBuffer_;
+		sdl::Buffer indexBuffer_;
+		SDL_GPUBuffer* vertexGpuBuffer_ = nullptr;
+		SDL_GPUBuffer* indexGpuBuffer_ = nullptr;
+		sdl::Buffer transparentVertexBuffer_;
+		sdl::Buffer transparentIndexBuffer_;
+		SDL_GPUBuffer* transparentVertexGpuBuffer_ = nullptr;
+		SDL_GPUBuffer* transparentIndexGpuBuffer_ = nullptr;
+	};
+
+	/// Indexed mesh already in GPU buffers, in the MeshVertex layout.
+	struct GpuMesh {
+		SDL_GPUBuffer* vertexBuffer = nullptr;
+		SDL_GPUBuffer* indexBuffer = nullptr;
+		Uint32 indexCount = 0;
+		glm::vec3 center{0.f};	// Bounding sphere in model space, never culled if unknown.
+		float radius = std::numeric_limits<float>::infinity();
+	};
+
+	/// A cached mesh uploaded once to its own GPU buffers, drawn with one instanced
+	/// call for all opaque instances added since the last clear. The transparent
+	/// instances are drawn by Graphic, sorted together with those of the other meshes.
+	class InstancedMesh {
+	public:
+		explicit InstancedMesh(const Mesh& mesh)
+			: mesh_{&mesh}
+			, indexCount_{static_cast<Uint32>(mesh.indices.size())} {
+		}
+
+		/// The buffers are owned by the caller and must outlive the instanced mesh.
+		explicit InstancedMesh(const GpuMesh& mesh)
+			: vertexBuffer_{mesh.vertexBuffer}
+			, indexBuffer_{mesh.indexBuffer}
+			, indexCount_{mesh.indexCount} {
+		}
+
+		/// The bounding sphere is in world space.
+		void addInstance(const InstanceData& instance, const glm::vec3& center, float radius) {
+			instances_.push_back(instance);
+			centers_.push_back(center);
+			bounds_.add(center, radius);
+		}
+
+		void clear() {
+			instances_.clear();
+			centers_.clear();
+			bounds_.clear();
+			opaqueCount_ = 0;
+		}
+
+		/// Removes the instances outside the frustum and returns the number removed.
+		size_t cull(const Frustum& frustum, FrameArena& arena) {
+			auto visible = arena.allocate<uint8_t>(bounds_.size());
+			if (bounds_.cull(frustum, visible) == instances_.size()) {
+				return 0;
+			}
+			size_t size = 0;
+			for (size_t i = 0; i < instances_.size(); ++i) {
+				if (visible[i] != 0) {
+					centers_[size] = centers_[i];
+					instances_[size++] = instances_[i];
+				}
+			}
+			const size_t culled = instances_.size() - size;
+			instances_.resize(size);
+			centers_.resize(size);
+			bounds_.clear();
+			return culled;
+		}
+
+		/// Sorts the opaque instances front to back from the eye, so the depth test rejects
+		/// the hidden fragments early, and moves the transparent instances last. Returns the
+		/// distance to the nearest opaque instance. Called before upload.
+		float sort(const glm::vec3& eye, FrameArena& arena) {
+			struct SortKey {
+				bool transparent;
+				float distance;
+				uint32_t index;
+			};
+			auto keys = arena.allocate<SortKey>(instances_.size());
+			for (uint32_t i = 0; i < instances_.size(); ++i) {
+				keys[i] = SortKey{
+					.transparent = isTransparent(instances_[i].color),
+					.distance = glm::length(centers_[i] - eye),
+					.index = i
+				};
+			}
+			std::sort(keys.begin(), keys.end(), [](const SortKey& a, const SortKey& b) {
+				return a.transparent != b.transparent ? b.transparent : a.distance < b.distance;
+			});
+
+			auto instances = arena.allocate<InstanceData>(instances_.size());
+			auto centers = arena.allocate<glm::vec3>(centers_.size());
+			opaqueCount_ = 0;
+			for (size_t i = 0; i < keys.size(); ++i) {
+				instances[i] = instances_[keys[i].index];
+				centers[i] = centers_[keys[i].index];
+				opaqueCount_ += keys[i].transparent ? 0 : 1;
+			}
+			std::copy(instances.begin(), instances.end(), instances_.begin());
+			std::copy(centers.begin(), centers.end(), centers_.begin());
+			return opaqueCount_ > 0 ? keys[0].distance : std::numeric_limits<float>::infinity();
+		}
+
+		size_t getOpaqueCount() const {
+			return opaqueCount_;
+		}
+
+		/// The transparent instances after sort, with their bounding sphere centers.
+		std::span<const InstanceData> getTransparentInstances() const {
+			return std::span{instances_}.subspan(opaqueCount_);
+		}
+
+		std::span<const glm::vec3> getTransparentCenters() const {
+			return std::span{centers_}.subspan(opaqueCount_);
+		}
+
+		void upload(SDL_GPUDevice* gpuDevice, UploadRing& uploadRing) {
+			if (instances_.empty()) {
+				return;
+			}
+			if (vertexBuffer_ == nullptr) {
+				// The mesh never changes, no need to cycle.
+				std::span<const MeshVertex> vertices = mesh_->vertices;
+				std::span<const uint32_t> indices = mesh_->indices;
+				vertexBuffer_ = meshVertexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, vertices);
+				indexBuffer_ = meshIndexBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, indices);
+				uploadRing.upload(vertices, vertexBuffer_, false);
+				uploadRing.upload(indices, indexBuffer_, false);
+			}
+			instanceCount_ = static_cast<Uint32>(opaqueCount_);
+			if (opaqueCount_ == 0) {
+				return;
+			}
+			std::span<const InstanceData> instances = std::span{instances_}.first(opaqueCount_);
+			instanceGpuBuffer_ = instanceBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, instances);
+			uploadRing.upload(instances, instanceGpuBuffer_, true);
+		}
+
+		/// Draws the opaque instances.
+		void draw(SDL_GPURenderPass* renderPass) {
+			if (instanceCount_ == 0) {
+				return;
+			}
+			draw(renderPass, instanceGpuBuffer_, 0, instanceCount_);
+			instanceCount_ = 0;
+		}
+
+		/// Draws count instances of the buffer, starting at first.
+		void draw(SDL_GPURenderPass* renderPass, SDL_GPUBuffer* instanceBuffer, Uint32 first, Uint32 count) const {
+			std::array<SDL_GPUBufferBinding, 2> vertexBindings{
+				SDL_GPUBufferBinding{
+					.buffer = vertexBuffer_,
+					.offset = 0
+				},
+				SDL_GPUBufferBinding{
+					.buffer = instanceBuffer,
+					.offset = static_cast<Uint32>(first * sizeof(InstanceData))
+				}
+			};
+			SDL_BindGPUVertexBuffers(
+				renderPass,
+				0,
+				vertexBindings.data(),
+				static_cast<Uint32>(vertexBindings.size())
+			);
+
+			SDL_GPUBufferBinding indexBinding{
+				.buffer = indexBuffer_,
+				.offset = 0
+			};
+			SDL_BindGPUIndexBuffer(
+				renderPass,
+				&indexBinding,
+				SDL_GPU_INDEXELEMENTSIZE_32BIT
+			);
+
+			SDL_DrawGPUIndexedPrimitives(
+				renderPass,
+				indexCount_,
+				count,
+				0,
+				0,
+				0
+			);
+		}
+
+	private:
+		const Mesh* mesh_ = nullptr;
+		std::vector<InstanceData> instances_;
+		std::vector<glm::vec3> centers_;	// Of the bounding spheres, for the sorting.
+		SphereBatch bounds_;
+		size_t opaqueCount_ = 0;	// The opaque instances are first after sort.
+		Uint32 instanceCount_ = 0;
+
+		sdl::Buffer meshVertexBuffer_;
+		sdl::Buffer meshIndexBuffer_;
+		SDL_GPUBuffer* vertexBuffer_ = nullptr;
+		SDL_GPUBuffer* indexBuffer_ = nullptr;
+		Uint32 indexCount_ = 0;
+
+		sdl::Buffer instanceBuffer_;
+		SDL_GPUBuffer* instanceGpuBuffer_ = nullptr;
+	};
+
+	/// Lines with world space endpoints, expanded in the vertex shader to quads of a fixed
+	/// width in pixels. Six vertices per line and no vertex buffer, the line is the instance.
+	class LineBatch {
+	public:
+		void add(const LineInstance& line) {
+			lines_.push_back(line);
+		}
+
+		void clear() {
+			lines_.clear();
+		}
+
+		size_t size() const {
+			return lines_.size();
+		}
+
+		void upload(SDL_GPUDevice* gpuDevice, UploadRing& uploadRing) {
+			lineCount_ = static_cast<Uint32>(lines_.size());
+			if (lines_.empty()) {
+				return;
+			}
+			std::span<const LineInstance> lines = lines_;
+			lineGpuBuffer_ = lineBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, lines);
+			uploadRing.upload(lines, lineGpuBuffer_, true);
+		}
+
+		void draw(SDL_GPURenderPass* renderPass) {
+			if (lineCount_ == 0) {
+				return;
+			}
+			SDL_GPUBufferBinding vertexBinding{
+				.buffer = lineGpuBuffer_,
+				.offset = 0
+			};
+			SDL_BindGPUVertexBuffers(
+				renderPass,
+				0,
+				&vertexBinding,
+				1
+			);
+			SDL_DrawGPUPrimitives(renderPass, 6, lineCount_, 0, 0);
+			lineCount_ = 0;
+		}
+
+	private:
+		std::vector<LineInstance> lines_;
+		Uint32 lineCount_ = 0;
+
+		sdl::Buffer lineBuffer_;
+		SDL_GPUBuffer* lineGpuBuffer_ = nullptr;
+	};
+
+	/// Spheres and capsules ray-cast in the pixel shader, see impostor.ps.hlsl. 36 vertices
+	/// per impostor for its bounding box and no vertex buffer, the capsule is the instance.
+	class ImpostorBatch {
+	public:
+		void add(const ImpostorInstance& impostor) {
+			impostors_.push_back(impostor);
+		}
+
+		void clear() {
+			impostors_.clear();
+		}
+
+		size_t size() const {
+			return impostors_.size();
+		}
+
+		void upload(SDL_GPUDevice* gpuDevice, UploadRing& uploadRing) {
+			impostorCount_ = static_cast<Uint32>(impostors_.size());
+			if (impostors_.empty()) {
+				return;
+			}
+			std::span<const ImpostorInstance> impostors = impostors_;
+			impostorGpuBuffer_ = impostorBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, impostors);
+			uploadRing.upload(impostors, impostorGpuBuffer_, true);
+		}
+
+		void draw(SDL_GPURenderPass* renderPass) {
+			if (impostorCount_ == 0) {
+				return;
+			}
+			SDL_GPUBufferBinding vertexBinding{
+				.buffer = impostorGpuBuffer_,
+				.offset = 0
+			};
+			SDL_BindGPUVertexBuffers(
+				renderPass,
+				0,
+				&vertexBinding,
+				1
+			);
+			SDL_DrawGPUPrimitives(renderPass, 36, impostorCount_, 0, 0);
+			impostorCount_ = 0;
+		}
+
+	private:
+		std::vector<ImpostorInstance> impostors_;
+		Uint32 impostorCount_ = 0;
+
+		sdl::Buffer impostorBuffer_;
+		SDL_GPUBuffer* impostorGpuBuffer_ = nullptr;
+	};
+
+	/// Checkerboard with grid lines on the plane z = 0, fading out with the distance.
+	struct Floor {
+		sdl::Color color1;
+		sdl::Color color2;
+		sdl::Color lineColor;	// The alpha is the strength of the lines.
+		float cellSize = 0.5f;	// Meters
+		float lineSpacing = 1.f;	// Meters
+		float lineWidth = 1.f;	// Pixels
+		float fadeDistance = 50.f;	// Meters from the camera
+	};
+
+	/// The camera of the frame, read by the geometry builders for the level of detail and
+	/// the culling. Not changed while building.
+	struct FrameCamera {
+		glm::mat4 projection{1.f};
+		glm::mat4 view{1.f};
+		int viewportWidth = 1;
+		int viewportHeight = 1;
+		Frustum frustum = Frustum::create(glm::mat4{1.f});
+		bool culling = true;
+
+		static FrameCamera create(const glm::mat4& projection, const glm::mat4& view, int viewportWidth, int viewportHeight, bool culling) {
+			return FrameCamera{
+				.projection = projection,
+				.view = view,
+				.viewportWidth = viewportWidth,
+				.viewportHeight = viewportHeight,
+				.frustum = Frustum::create(projection * view),
+				.culling = culling
+			};
+		}
+	};
+
+	/// Builds the geometry of a part of the scene with its own matrix stack, triangle batch,
+	/// transforms, instances and lines. Builders are independent of each other, so parts of
+	/// the scene can be built in parallel, one builder per job, and then given to
+	/// Graphic::submit. Graphic is itself the builder of the main thread.
+	class GeometryBuilder {
+	public:
+		/// The camera and the mesh cache are shared and must outlive the builder.
+		GeometryBuilder(const FrameCamera& camera, MeshCache& meshCache)
+			: camera_{&camera}
+			, meshCache_{&meshCache} {
+		}
+
+		void pushMatrix() {
+			matrices_.push();
+		}
+
+		void popMatrix() {
+			if (matrices_.pop()) {
+				transformIndex_ = NoTransformIndex;
+			}
+		}
+
+		void loadIdentityMatrix() {
+			matrices_.reset();
+			transformIndex_ = NoTransformIndex;
+		}
+
+		void translate(const glm::vec3& translation) {
+			matrices_.top() = glm::translate(matrices_.top(), translation);
+			transformIndex_ = NoTransformIndex;
+		}
+
+		void rotate(float angleRadians, const glm::vec3& axis) {
+			matrices_.top() = glm::rotate(matrices_.top(), angleRadians, axis);
+			transformIndex_ = NoTransformIndex;
+		}
+
+		void scale(const glm::vec3& scale) {
+			matrices_.top() = glm::scale(matrices_.top(), scale);
+			transformIndex_ = NoTransformIndex;
+		}
+
+		void multiplyMatrix(const glm::mat4& matrix) {
+			matrices_.top() = matrices_.top() * matrix;
+			transformIndex_ = NoTransformIndex;
+		}
+
+		const glm::mat4& getMatrix() const {
+			return matrices_.top();
+		}
+
+		/// Returns false if the sphere, in the space of the current matrix, is outside the
+		/// view frustum. Used to skip whole objects before adding their geometry.
+		bool isVisible(const glm::vec3& center, float radius) const {
+			if (!camera_->culling) {
+				return true;
+			}
+			const auto bounds = getWorldBounds(center, radius);
+			return camera_->frustum.isVisible(bounds.center, bounds.radius);
+		}
+
+		/// Returns the length size in pixels, at the closest point to the camera of the sphere
+		/// in world space.
+		float getScreenSize(const glm::vec3& center, float radius, float size) const {
+			const float distance = -(camera_->view * glm::vec4{center, 1.f}).z - radius;
+			if (distance <= 0) {
+				// The camera is inside the sphere.
+				return std::numeric_limits<float>::max();
+			}
+			return size * camera_->projection[1][1] * 0.5f * camera_->viewportHeight / distance;
+		}
+
+		void addSolidCube(float size, sdl::Color color) {
+			if (recording_ != nullptr) {
+				addMeshVertices(meshCache_->getCube(), glm::vec3{size}, {1.f, 1.f}, color, VertexFlag::None);
+				return;
+			}
+			addInstance(meshCache_->getCube(), glm::scale(getMatrix(), glm::vec3{size}), color, DrawMode::Light, getWorldBounds(glm::vec3{0.f}, 0.5f * std::sqrt(3.f) * size));
+		}
+
+		void addSolidSphere(float radius, unsigned int slices, unsigned int stacks, sdl::Color color, DrawMode drawMode = DrawMode::Light) {
+			addSphere(meshCache_->getSphere(slices, stacks), radius, color, drawMode);
+		}
+
+		/// Sphere tessellated from the size on the screen.
+		void addSolidSphere(float radius, sdl::Color color, DrawMode drawMode = DrawMode::Light) {
+			addSphere(meshCache_->getSphereLod(selectLod(glm::vec3{0.f}, radius, radius)), radius, color, drawMode);
+		}
+
+		/// Draws the mesh with the current matrix. Not recorded into static geometry.
+		void addMesh(const GpuMesh& mesh, sdl::Color color) {
+			const auto bounds = getWorldBounds(mesh.center, mesh.radius);
+			instances_.push_back(BuiltInstance{
+				.gpuMesh = &mesh,
+				.instance = InstanceData{
+					.model = getMatrix(),
+					.color = color
+				},
+				.variant = ShaderVariant::get(VertexFlag::None),
+				.center = bounds.center,
+				.radius = bounds.radius
+			});
+		}
+
+		void addRectangle(const glm::vec2& pos, const glm::vec2& size, sdl::Color color) {
+			glm::vec3 pos3{pos, 0.0f};
+			glm::vec3 normal = glm::vec3{0.0f, 0.0f, 1.0f};
+
+			startShape(color);
+			addVertex(pos3, color, normal);
+			addVertex({pos3.x + size.x, pos3.y, pos3.z}, color, normal);
+			addVertex({pos3.x + size.x, pos3.y + size.y, pos3.z}, color, normal);
+			addVertex({pos3.x, pos3.y + size.y, pos3.z}, color, normal);
+
+			batch(color).insertIndices({
+				0, 1, 2,
+				2, 3, 0 
+			});
+		}
+
+		/// Records the following geometry into the static geometry instead of the
+		/// per frame batch, until endStatic is called. The vertices are transformed
+		/// by the current matrix when recorded.
+		void beginStatic(StaticGeometry& geometry) {
+			geometry.clear();
+			recording_ = &geometry;
+			staticTransformIndex_ = 0;
+		}
+
+		void endStatic() {
+			recording_->finish();
+			recording_ = nullptr;
+		}
+
+		/// Selects the transform, given to drawStatic, of the following recorded vertices.
+		/// Used for rigid skinning, where each vertex follows one link frame.
+		void setStaticTransformIndex(uint32_t index) {
+			staticTransformIndex_ = index;
+		}
+
+		/// Draws the static geometry this frame, only uploaded if recorded since the last upload.
+		/// The recorded vertices are transformed by transforms[index] in the vertex shader,
+		/// the identity is used if no transforms are given.
+		void drawStatic(StaticGeometry& geometry, std::span<const glm::mat4> transforms = {}) {
+			uint32_t transformOffset = 0;
+			if (!transforms.empty()) {
+				transformOffset = static_cast<uint32_t>(transforms_.size());
+				transforms_.insert(transforms_.end(), transforms.begin(), transforms.end());
+			}
+			staticDraws_.push_back(StaticDraw{&geometry, transformOffset});
+		}
+
+		/// Line from p1 to p2 in world space, one pixel wide. Only for static geometry with
+		/// SDL_GPU_PRIMITIVETYPE_LINELIST.
+		void addLineSegment(const glm::vec3& p1, const glm::vec3& p2, sdl::Color color) {
+			startShape(color, VertexFlag::NoLight);
+			addVertex(p1, color, {}, VertexFlag::NoLight);
+			addVertex(p2, color, {}, VertexFlag::NoLight);
+			batch(color, VertexFlag::NoLight).insertIndices({0, 1});
+		}
+
+		/// Removes the geometry of the last frame and loads the identity matrix.
+		void clear() {
+			for (auto& triangles : trianglesBuffers_) {
+				triangles.batch().clear();
+			}
+			for (auto& triangles : transparentTrianglesBuffers_) {
+				triangles.batch().clear();
+			}
+			for (auto& shapes : transparentShapes_) {
+				shapes.clear();
+			}
+			// Index 0 is reserved for the identity, used by the static geometry.
+			transforms_.assign(1, glm::mat4{1.f});
+			matrices_.reset();
+			transformIndex_ = NoTransformIndex;
+			instances_.clear();
+			lines_.clear();
+			impostors_.clear();
+			staticDraws_.clear();
+		}
+
+		/// Line from p1 to p2 in the space of the current matrix, pixelSize pixels wide on
+		/// screen. Projected in the vertex shader with the matrices of the frame being drawn.
+		/// Always part of the frame, not of static geometry being recorded.
+		void addLine(const glm::vec3& p1, const glm::vec3& p2, float pixelSize, sdl::Color color) {
+			lines_.push_back(LineInstance{
+				.p1 = glm::vec3{getMatrix() * glm::vec4{p1, 1.f}},
+				.width = pixelSize,
+				.p2 = glm::vec3{getMatrix() * glm::vec4{p2, 1.f}},
+				.color = glm::packUnorm4x8(glm::vec4{color})
+			});
+		}
+
+		/// Sphere ray-cast per pixel instead of tessellated, exact at any distance. In the space
+		/// of the current matrix and always part of the frame, as addLine. Opaque only.
+		void addSphereImpostor(const glm::vec3& center, float radius, sdl::Color color, DrawMode drawMode = DrawMode::Light) {
+			addCapsuleImpostor(center, center, radius, color, drawMode);
+		}
+
+		/// Capsule, the points within radius of the segment p1 to p2, ray-cast as addSphereImpostor.
+		void addCapsuleImpostor(const glm::vec3& p1, const glm::vec3& p2, float radius, sdl::Color color, DrawMode drawMode = DrawMode::Light) {
+			if (!isVisible(0.5f * (p1 + p2), 0.5f * glm::length(p2 - p1) + radius)) {
+				return;
+			}
+			impostors_.push_back(BuiltImpostor{
+				.impostor = ImpostorInstance{
+					.p1 = glm::vec3{getMatrix() * glm::vec4{p1, 1.f}},
+					.radius = getMatrixScale() * radius,
+					.p2 = glm::vec3{getMatrix() * glm::vec4{p2, 1.f}},
+					.color = glm::packUnorm4x8(glm::vec4{color})
+				},
+				.variant = ShaderVariant::get(toVertexFlags(drawMode))
+			});
+		}
+
+		void addCircle(const glm::vec2& center, float radius, sdl::Color color, unsigned int iterations = 30, float startAngle = 0) {
+			startShape(color);
+
+			// Add center vertex
+			addVertex(glm::vec3{center, 0.0f}, color);
+
+			// Add perimeter vertices
+			for (unsigned int i = 0; i <= iterations; ++i) {
+				float angle = startAngle + (2.0f * Pi * i) / iterations;
+				glm::vec2 pos = center + radius * glm::vec2{std::cos(angle), std::sin(angle)};
+				addVertex(glm::vec3{pos, 0.0f}, color);
+			}
+
+			// Create triangles from center to perimeter
+			for (unsigned int i = 0; i < iterations; ++i) {
+				batch(color).insertIndices({
+					0, i + 1, i + 2
+				});
+			}
+		}
+
+		void addCircleOutline(const glm::vec2& center, float radius, float width, sdl::Color color, unsigned int iterations = 30, float startAngle = 0) {
+			startShape(color);
+
+			float innerRadius = radius - width * 0.5f;
+			float outerRadius = radius + width * 0.5f;
+
+			// Add vertices for inner and outer circles
+			for (unsigned int i = 0; i <= iterations; ++i) {
+				float angle = startAngle + (2.0f * Pi * i) / iterations;
+				glm::vec2 direction{std::cos(angle), std::sin(angle)};
+
+				glm::vec2 innerPos = center + innerRadius * direction;
+				glm::vec2 outerPos = center + outerRadius * direction;
+
+				addVertex(glm::vec3{innerPos, 0.0f}, color);
+				addVertex(glm::vec3{outerPos, 0.0f}, color);
+			}
+
+			// Create quad strips between inner and outer circles
+			for (unsigned int i = 0; i < iterations; ++i) {
+				unsigned int baseIndex = i * 2;
+				batch(color).insertIndices({
+					baseIndex, baseIndex + 1, baseIndex + 3,
+					baseIndex + 3, baseIndex + 2, baseIndex
+				});
+			}
+		}
+
+		void addPolygon(std::initializer_list<glm::vec2> points, sdl::Color color) {
+			addPolygon(points.begin(), points.end(), color);
+		}
+
+		void addPolygon(std::input_iterator auto begin, std::input_iterator auto end, sdl::Color color) {
+			startShape(color);
+			for (auto it = begin; it != end; ++it) {
+				addVertex(glm::vec3{*it, 0.f}, color);
+			}
+			const auto size = std::distance(begin, end);
+			for (unsigned int i = 1; i < size - 1; ++i) {
+				batch(color).insertIndices({0, i, i + 1});
+			}
+		}
+
+		void addCylinder(float baseRadius, float topRadius, float height, unsigned int slices, unsigned int stacks, sdl::Color color) {
+			addCylinder(meshCache_->getCylinder(slices, stacks), baseRadius, topRadius, height, color);
+		}
+
+		/// Cylinder tessellated from the size on the screen.
+		void addCylinder(float baseRadius, float topRadius, float height, sdl::Color color) {
+			const float radius = std::max(baseRadius, topRadius);
+			const float boundingRadius = std::sqrt(radius * radius + 0.25f * height * height);
+			const int level = selectLod(glm::vec3{0.f, 0.f, 0.5f * height}, boundingRadius, radius);
+			addCylinder(meshCache_->getCylinderLod(level), baseRadius, topRadius, height, color);
+		}
+
+		void addPixel(const glm::vec2& point, sdl::Color color, float size = 1.f) {
+			addRectangle(point - glm::vec2{size * 0.5f}, glm::vec2{size}, color);
+		}
+
+	private:
+		friend class Graphic;
+
+		struct BoundingSphere {
+			glm::vec3 center;
+			float radius;
+		};
+
+		// The sphere in the space of the current matrix, transformed to world space.
+		BoundingSphere getWorldBounds(const glm::vec3& center, float radius) const {
+			return {glm::vec3{getMatrix() * glm::vec4{center, 1.f}}, getMatrixScale() * radius};
+		}
+
+		// Largest scale factor of the current matrix.
+		float getMatrixScale() const {
+			const glm::mat4& matrix = getMatrix();
+			return std::max({glm::length(glm::vec3{matrix[0]}), glm::length(glm::vec3{matrix[1]}), glm::length(glm::vec3{matrix[2]})});
+		}
+
+		void addInstance(const Mesh& mesh, const glm::mat4& model, sdl::Color color, DrawMode drawMode, const BoundingSphere& bounds, const glm::vec2& radius = {1.f, 1.f}) {
+			instances_.push_back(BuiltInstance{
+				.mesh = &mesh,
+				.instance = InstanceData{
+					.model = model,
+					.color = color,
+					.radius = radius
+				},
+				.variant = ShaderVariant::get(toVertexFlags(drawMode)),
+				.center = bounds.center,
+				.radius = bounds.radius
+			});
+		}
+
+		// Level of detail of a primitive with the bounding sphere and the radius in model space.
+		int selectLod(const glm::vec3& center, float boundingRadius, float radius) const {
+			if (recording_ != nullptr) {
+				// Static geometry is kept for many frames and camera positions.
+				return MeshCache::LodCount - 1;
+			}
+			const auto bounds = getWorldBounds(center, boundingRadius);
+			const float screenRadius = getScreenSize(bounds.center, bounds.radius, getMatrixScale() * radius);
+			return MeshCache::getLodLevel(screenRadius);
+		}
+
+		void addSphere(const Mesh& mesh, float radius, sdl::Color color, DrawMode drawMode) {
+			if (recording_ != nullptr) {
+				addMeshVertices(mesh, glm::vec3{radius}, {1.f, 1.f}, color, toVertexFlags(drawMode));
+				return;
+			}
+			addInstance(mesh, glm::scale(getMatrix(), glm::vec3{radius}), color, drawMode, getWorldBounds(glm::vec3{0.f}, radius));
+		}
+
+		void addCylinder(const Mesh& mesh, float baseRadius, float topRadius, float height, sdl::Color color) {
+			// The unit mesh has the radius 1 and the height 1.
+			if (recording_ != nullptr) {
+				addMeshVertices(mesh, glm::vec3{1.f, 1.f, height}, {baseRadius, topRadius}, color, VertexFlag::None);
+				return;
+			}
+			const float radius = std::max(baseRadius, topRadius);
+			const auto bounds = getWorldBounds(glm::vec3{0.f, 0.f, 0.5f * height}, std::sqrt(radius * radius + 0.25f * height * height));
+			addInstance(mesh, glm::scale(getMatrix(), glm::vec3{1.f, 1.f, height}), color, DrawMode::Light, bounds, {baseRadius, topRadius});
+		}
+
+		static uint32_t toVertexFlags(DrawMode drawMode) {
+			return DrawMode::NoLight == drawMode ? VertexFlag::NoLight : VertexFlag::None;
+		}
+
+		// Same shape as the instanced mesh, see instanced.vs.hlsl, but added to the batch.
+		void addMeshVertices(const Mesh& mesh, const glm::vec3& scale, const glm::vec2& radius, sdl::Color color, uint32_t flags) {
+			startShape(color, flags);
+			for (const auto& vertex : mesh.vertices) {
+				glm::vec3 position = vertex.position;
+				const float r = radius.x + (radius.y - radius.x) * position.z;
+				position.x *= r;
+				position.y *= r;
+				addVertex(scale * position, color, vertex.normal, flags);
+			}
+			for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+				batch(color, flags).insertIndices({mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2]});
+			}
+		}
+
+		// One batch per shader variant of the flags. Transparent shapes go to their own
+		// batches, drawn blended after all opaque geometry.
+		sdl::Batch<Vertex>& batch(sdl::Color color, uint32_t flags = VertexFlag::None) {
+			if (recording_ != nullptr) {
+				return recording_->batch(color);
+			}
+			auto& buffers = isTransparent(color) ? transparentTrianglesBuffers_ : trianglesBuffers_;
+			return buffers[ShaderVariant::get(flags)].batch();
+		}
+
+		// The shapes of the batch of the color and flags, nullptr if drawn opaque.
+		std::vector<TransparentShape>* getTransparentShapes(sdl::Color color, uint32_t flags) {
+			if (recording_ != nullptr) {
+				return recording_->getTransparentShapes(color);
+			}
+			return isTransparent(color) ? &transparentShapes_[ShaderVariant::get(flags)] : nullptr;
+		}
+
+		// Every shape starts here. A transparent shape keeps its index range and center, it
+		// is sorted on its own with the other transparent geometry.
+		void startShape(sdl::Color color, uint32_t flags = VertexFlag::None) {
+			auto& shapeBatch = batch(color, flags);
+			shapeBatch.startBatch();
+			if (auto* shapes = getTransparentShapes(color, flags)) {
+				shapes->push_back(TransparentShape{
+					.firstIndex = static_cast<uint32_t>(shapeBatch.indices().size()),
+					.transformIndex = recording_ != nullptr ? staticTransformIndex_ : 0
+				});
+			}
+		}
+
+		void addVertex(const glm::vec3& position, sdl::Color color, const glm::vec3& normal = {}, uint32_t flags = VertexFlag::None) {
+			if (auto* shapes = getTransparentShapes(color, flags)) {
+				shapes->back().positionSum += glm::vec3{getMatrix() * glm::vec4{position, 1.f}};
+				++shapes->back().vertexCount;
+			}
+			if (recording_ != nullptr || !Vertex::HasTransformIndex) {
+				// Static geometry outlives the transforms of the frame, transform on the CPU.
+				const uint32_t transformIndex = recording_ != nullptr ? staticTransformIndex_ : 0;
+				batch(color, flags).pushBack(Vertex::create(
+					getMatrix() * glm::vec4{position, 1},
+					glm::vec3{getMatrix() * glm::vec4{normal, 0.f}},
+					color,
+					flags | (transformIndex << VertexFlag::TransformShift)
+				));
+				return;
+			}
+			// Object space, the vertex shader applies the current matrix.
+			if (transformIndex_ == NoTransformIndex) {
+				transformIndex_ = static_cast<uint32_t>(transforms_.size());
+				transforms_.push_back(getMatrix());
+			}
+			batch(color, flags).pushBack(Vertex::create(position, normal, color, flags | (transformIndex_ << VertexFlag::TransformShift)));
+		}
+
+		static constexpr uint32_t NoTransformIndex = ~0u;
+
+		const FrameCamera* camera_;
+		MeshCache* meshCache_;
+
+		MatrixStack matrices_;
+		std::vector<glm::mat4> transforms_{glm::mat4{1.f}};
+		uint32_t transformIndex_ = NoTransformIndex;	// Index of the current matrix in transforms_.
+		std::array<TrianglesBuffer, ShaderVariant::Count> trianglesBuffers_;	// Index is the variant.
+		std::array<TrianglesBuffer, ShaderVariant::Count> transparentTrianglesBuffers_;
+		std::array<std::vector<TransparentShape>, ShaderVariant::Count> transparentShapes_;	// In transparentTrianglesBuffers_.
+
+		// Merged into the instanced meshes of Graphic, one of the meshes is set.
+		struct BuiltInstance {
+			const Mesh* mesh = nullptr;
+			const GpuMesh* gpuMesh = nullptr;
+			InstanceData instance;
+			uint32_t variant;
+			glm::vec3 center;
+			float radius;
+		};
+		std::vector<BuiltInstance> instances_;
+		std::vector<LineInstance> lines_;
+
+		struct BuiltImpostor {
+			ImpostorInstance impostor;
+			uint32_t variant;
+		};
+		std::vector<BuiltImpostor> impostors_;
+
+		struct StaticDraw {
+			StaticGeometry* geometry;
+			uint32_t transformOffset;
+		};
+		std::vector<StaticDraw> staticDraws_;
+		StaticGeometry* recording_ = nullptr;
+		uint32_t staticTransformIndex_ = 0;
+	};
+
+	class Graphic : public GeometryBuilder {
+	public:
+		Graphic()
+			: GeometryBuilder{camera_, meshCache_} {
+		}
+
+		void preLoop(SDL_GPUDevice* gpuDevice, SDL_GPUSampleCount gpuSampleCount) {
+			shader_.load(gpuDevice);
+			gpuSampleCount_ = gpuSampleCount;
+			createPipelines(gpuDevice);
+			setupLineBatchPipeline(gpuDevice);
+			setupFloorPipeline(gpuDevice);
+
+			auto transparentSurface = createSdlSurface(1, 1, sdl::color::White);
+			texture_ = sdl::uploadSurface(gpuDevice, transparentSurface.get());
+
+			sampler_ = sdl::createGpuSampler(gpuDevice, SDL_GPUSamplerCreateInfo{
+				.min_filter = SDL_GPU_FILTER_NEAREST,
+				.mag_filter = SDL_GPU_FILTER_NEAREST,
+				.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+				.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+				.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+				.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE
+			});
+		}
+
+		void setupLineBatchPipeline(SDL_GPUDevice* gpuDevice) {
+			// One LineInstance per instance, the quad corners come from the vertex id.
+			SDL_GPUVertexBufferDescription vertexBufferDescription{
+				.slot = 0,
+				.pitch = sizeof(LineInstance),
+				.input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE
+			};
+			SDL_GPUVertexInputState vertexInputState{
+				.vertex_buffer_descriptions = &vertexBufferDescription,
+				.num_vertex_buffers = 1,
+				.vertex_attributes = shader_.lineAttributes.data(),
+				.num_vertex_attributes = static_cast<Uint32>(shader_.lineAttributes.size())
+			};
+			lineBatchPipeline_ = createGraphicsPipeline(gpuDevice, shader_.lineVertexShader.get(), shader_.getFragmentShader(VertexFlag::NoLight),
+				vertexInputState, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, true, true);
+		}
+
+		void setupFloorPipeline(SDL_GPUDevice* gpuDevice) {
+			// No vertex input, one full-screen triangle from the vertex id. Blended, the floor
+			// fades out in the distance.
+			floorPipeline_ = createGraphicsPipeline(gpuDevice, shader_.floorVertexShader.get(), shader_.floorFragmentShader.get(),
+				SDL_GPUVertexInputState{}, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, true, true);
+		}
+
+		/// Sets the camera of the frame, must be called before adding geometry since it is used for
+		/// the level of detail and the screen-space lines.
+		void setCamera(const glm::mat4& projection, const glm::mat4& viewMatrix, int viewportWidth, int viewportHeight) {
+			camera_ = FrameCamera::create(projection, viewMatrix, viewportWidth, viewportHeight, camera_.culling);
+		}
+
+		/// Sets the camera the submitted builders were built with, the culling included.
+		void setCamera(const FrameCamera& camera) {
+			camera_ = camera;
+		}
+
+		/// Instances outside the view frustum are removed before the upload.
+		void setCulling(bool culling) {
+			camera_.culling = culling;
+		}
+
+		bool isCulling() const {
+			return camera_.culling;
+		}
+
+		/// Returns the number of instances removed by the culling in the last frame.
+		size_t getCulledInstances() const {
+			return culledInstances_;
+		}
+
+		/// Returns a builder for a part of the scene, e.g. for a job, sharing the camera and
+		/// the meshes of this graphic.
+		GeometryBuilder createBuilder() {
+			return GeometryBuilder{camera_, meshCache_};
+		}
+
+		/// Returns a builder with its own camera, e.g. for building the next frame while this
+		/// one is rendered. The camera must outlive the builder.
+		GeometryBuilder createBuilder(const FrameCamera& camera) {
+			return GeometryBuilder{camera, meshCache_};
+		}
+
+		/// Removes the geometry of the last frame, of this graphic and the submitted builders.
+		void clear() {
+			GeometryBuilder::clear();
+			for (auto& instancedMeshes : instancedMeshes_) {
+				for (auto& [mesh, instancedMesh] : instancedMeshes) {
+					instancedMesh.clear();
+				}
+			}
+			lineBatch_.clear();
+			for (auto& impostorBatch : impostorBatches_) {
+				impostorBatch.clear();
+			}
+			floor_.reset();
+			builders_.assign(1, this);
+			frameArena_.reset();
+		}
+
+		/// Adds the geometry of the builder to the frame. Called on the main thread when the
+		/// builder is done, before gpuCopyPass. The builder is read again by gpuCopyPass.
+		void submit(GeometryBuilder& builder) {
+			merge(builder);
+			builders_.push_back(&builder);
+		}
+
+		/// Draws the floor in this frame, the plane z = 0 to the horizon. It is computed per
+		/// pixel in a full-screen pass, the cost is independent of its size.
+		void addFloor(const Floor& floor) {
+			floor_ = floor;
+		}
+
+		/// Draws in the order: the opaque instances front to back, the triangle batches, the
+		/// static geometry, the impostors, the floor, the transparent instances and shapes
+		/// back to front, and last the lines.
+		void bindAndDraw(SDL_GPUDevice* gpuDevice, SDL_GPUCommandBuffer* commandBuffer, SDL_GPURenderPass* renderPass) {
+			uint32_t boundVariant = ShaderVariant::Count;
+			for (auto [variant, distance, instancedMesh] : opaqueMeshes_) {
+				if (variant != boundVariant) {
+					SDL_BindGPUGraphicsPipeline(renderPass, getInstancedPipeline(variant, false));
+					bindFragmentResources(renderPass);
+					boundVariant = variant;
+				}
+				instancedMesh->draw(renderPass);
+			}
+
+			for (const auto& data : gpuDatas_) {
+				drawTriangles(commandBuffer, renderPass, TriangleRange{
+					.pipeline = data.pipeline,
+					.vertexBuffer = data.vertexBuffer,
+					.indexBuffer = data.indexBuffer,
+					.transformOffset = data.transformOffset,
+					.firstIndex = 0,
+					.indexCount = static_cast<Uint32>(data.indices.size())
+				});
+			}
+			gpuDatas_.clear();
+
+			for (auto [geometry, transformOffset] : frameStaticDraws_) {
+				if (geometry->getPrimitiveType() == SDL_GPU_PRIMITIVETYPE_LINELIST) {
+					SDL_BindGPUGraphicsPipeline(renderPass, getLinesPipeline(geometry->getVariant()));
+				} else {
+					SDL_BindGPUGraphicsPipeline(renderPass, getTrianglesPipeline(geometry->getVariant(), false));
+				}
+				SDL_BindGPUVertexStorageBuffers(renderPass, 0, &transformsGpuBuffer_, 1);
+				shader_.uploadTransformOffset(commandBuffer, transformOffset);
+				bindFragmentResources(renderPass);
+				geometry->draw(renderPass);
+			}
+			frameStaticDraws_.clear();
+
+			for (uint32_t variant = 0; variant < ShaderVariant::Count; ++variant) {
+				if (impostorBatches_[variant].size() == 0) {
+					continue;
+				}
+				SDL_BindGPUGraphicsPipeline(renderPass, getImpostorPipeline(variant));
+				bindFragmentResources(renderPass);
+				shader_.uploadImpostorData(commandBuffer, camera_.projection * camera_.view);
+				impostorBatches_[variant].draw(renderPass);
+			}
+
+			// After the opaque geometry, which hides most of it. Before the transparent
+			// geometry, which is blended over it.
+			if (floor_) {
+				drawFloor(commandBuffer, renderPass);
+			}
+
+			// The transparent instances and shapes of the batches, back to front.
+			boundVariant = ShaderVariant::Count;
+			for (auto [variant, instancedMesh, first, count] : transparentRuns_) {
+				if (instancedMesh == nullptr) {
+					drawTriangles(commandBuffer, renderPass, transparentShapeDraws_[first].triangles);
+					boundVariant = ShaderVariant::Count;	// Bound its own pipeline.
+					continue;
+				}
+				if (variant != boundVariant) {
+					SDL_BindGPUGraphicsPipeline(renderPass, getInstancedPipeline(variant, true));
+					bindFragmentResources(renderPass);
+					boundVariant = variant;
+				}
+				instancedMesh->draw(renderPass, transparentInstanceGpuBuffer_, first, count);
+			}
 
-		sdl::Batch<Vertex>& batch() {
-			return batch_;
+			SDL_BindGPUGraphicsPipeline(renderPass, lineBatchPipeline_.get());
+			bindFragmentResources(renderPass);
+			// Pushed last, b1 holds the transform offset for the other vertex shaders.
+			shader_.uploadViewportSize(commandBuffer, camera_.viewportWidth, camera_.viewportHeight);
+			lineBatch_.draw(renderPass);
 		}
 
-	private:
-		sdl::TransferBuffer vertexTransferBuffer_;
-		sdl::TransferBuffer indexTransferBuffer_;
-		sdl::Buffer vertexBuffer_;
-		sdl::Buffer indexBuffer_;
-		sdl::Batch<Vertex> batch_;
-	};
+		/// Uploads the geometry of the frame, of this graphic and the submitted builders, through
+		/// the upload ring, on a command buffer submitted before the one of the frame.
+		void gpuCopyPass(SDL_GPUDevice* gpuDevice) {
+			merge(*this);
+			culledInstances_ = 0;
+			if (camera_.culling) {
+				for (auto& instancedMeshes : instancedMeshes_) {
+					for (auto& [mesh, instancedMesh] : instancedMeshes) {
+						culledInstances_ += instancedMesh.cull(camera_.frustum, frameArena_);
+					}
+				}
+			}
+			uploadRing_.beginFrame(gpuDevice);
+			transparentShapeDraws_.clear();
+			// One transform buffer, the indices of each builder start at its offset.
+			frameTransforms_.clear();
+			for (GeometryBuilder* builder : builders_) {
+				const auto transformOffset = static_cast<uint32_t>(frameTransforms_.size());
+				frameTransforms_.insert(frameTransforms_.end(), builder->transforms_.begin(), builder->transforms_.end());
+				for (uint32_t variant = 0; variant < ShaderVariant::Count; ++variant) {
+					auto& triangles = builder->trianglesBuffers_[variant];
+					if (!triangles.batch().indices().empty()) {
+						gpuDatas_.push_back(triangles.upload(gpuDevice, uploadRing_, getTrianglesPipeline(variant, false), transformOffset));
+					}
+					auto& transparentTriangles = builder->transparentTrianglesBuffers_[variant];
+					if (!transparentTriangles.batch().indices().empty()) {
+						const auto data = transparentTriangles.upload(gpuDevice, uploadRing_, getTrianglesPipeline(variant, true), transformOffset);
+						auto& shapes = builder->transparentShapes_[variant];
+						finishTransparentShapes(shapes, data.indices.size());
+						for (const auto& shape : shapes) {
+							// The center is in world space.
+							addTransparentShape(variant, shape, shape.getCenter(), data.pipeline, data.vertexBuffer, data.indexBuffer, transformOffset);
+						}
+					}
+				}
+				for (auto [geometry, offset] : builder->staticDraws_) {
+					geometry->upload(gpuDevice, uploadRing_);
+					frameStaticDraws_.push_back(StaticDraw{geometry, transformOffset + offset});
+					for (const auto& shape : geometry->getTransparentShapes()) {
+						// Moved by the transform of the shape in the vertex shader.
+						const glm::mat4& transform = frameTransforms_[transformOffset + offset + shape.transformIndex];
+						addTransparentShape(geometry->getVariant(), shape, glm::vec3{transform * glm::vec4{shape.getCenter(), 1.f}},
+							getTrianglesPipeline(geometry->getVariant(), true), geometry->getTransparentVertexBuffer(), geometry->getTransparentIndexBuffer(),
+							transformOffset + offset);
+					}
+				}
+			}
+			// After the shapes are uploaded, they are sorted with the instances.
+			sortInstances();
+			std::span<const glm::mat4> transforms = frameTransforms_;
+			transformsGpuBuffer_ = transformsBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, transforms);
+			uploadRing_.upload(transforms, transformsGpuBuffer_, true);
+			for (auto& instancedMeshes : instancedMeshes_) {
+				for (auto& [mesh, instancedMesh] : instancedMeshes) {
+					instancedMesh.upload(gpuDevice, uploadRing_);
+				}
+			}
+			if (!transparentInstances_.empty()) {
+				std::span<const InstanceData> instances = transparentInstances_;
+				transparentInstanceGpuBuffer_ = transparentInstanceBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, instances);
+				uploadRing_.upload(instances, transparentInstanceGpuBuffer_, true);
+			}
+			lineBatch_.upload(gpuDevice, uploadRing_);
+			for (auto& impostorBatch : impostorBatches_) {
+				impostorBatch.upload(gpuDevice, uploadRing_);
+			}
+			uploadLights(gpuDevice);
+			uploadRing_.endFrame();
+		}
 
-	class Graphic {
-	public:
-		static constexpr glm::vec2 NoTexture{-1.0f, -1.0f};
-		static constexpr glm::vec2 NoLight{-2.0f, -2.0f};
-		static constexpr glm::vec2 NoProjection{-3.0f, -3.0f};
+		const UploadRingStats& getUploadStats() const {
+			return uploadRing_.getStats();
+		}
 
-		Graphic() {
-			loadIdentityMatrix();
+		/// Sets the lights of the frame, assigned to the clusters of the camera in gpuCopyPass.
+		/// The number of lights is not limited, a fragment only evaluates the lights reaching it.
+		void setLighting(const LightingData& lightingData) {
+			cameraPos_ = lightingData.cameraPos;
+			ambient_ = glm::vec3{0.f};
+			lights_.clear();
+			lightSpheres_.clear();
+			for (const auto& light : lightingData.lights) {
+				if (!light.enabled) {
+					continue;
+				}
+				const glm::vec4 color = light.color;
+				ambient_ += glm::vec3{color} * light.ambientStrength;
+				lights_.push_back(GpuLight{
+					.position = glm::vec4{light.position, 1.f},
+					.color = color,
+					.params = glm::vec4{light.radius, light.ambientStrength, light.shininess, 0.f}
+				});
+				lightSpheres_.push_back(LightSphere{
+					.position = light.position,
+					.radius = light.radius
+				});
+			}
 		}
 
-		void preLoop(SDL_GPUDevice* gpuDevice, SDL_GPUSampleCount gpuSampleCount) {
-			shader_.load(gpuDevice);
-			setupTrianglesPipeline(gpuDevice, gpuSampleCount);
+		const LightClusters& getLightClusters() const {
+			return lightClusters_;
+		}
 
-			auto transparentSurface = createSdlSurface(1, 1, sdl::color::White);
-			texture_ = sdl::uploadSurface(gpuDevice, transparentSurface.get());
+		/// Uploads the matrices given to setCamera.
+		void uploadProjectionMatrix(SDL_GPUCommandBuffer* commandBuffer) {
+			shader_.uploadProjectionMatrix(commandBuffer, camera_.projection * camera_.view);
+		}
 
-			sampler_ = sdl::createGpuSampler(gpuDevice, SDL_GPUSamplerCreateInfo{
-				.min_filter = SDL_GPU_FILTER_NEAREST,
-				.mag_filter = SDL_GPU_FILTER_NEAREST,
-				.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
-				.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
-				.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
-				.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE
+		/// Uploads the uniforms of the lights given to setLighting, after gpuCopyPass.
+		void uploadLightingData(SDL_GPUCommandBuffer* commandBuffer) {
+			const glm::mat4& view = camera_.view;
+			shader_.uploadLightingData(commandBuffer, LightUniforms{
+				.cameraPos = glm::vec4{cameraPos_, 1.f},
+				.ambient = glm::vec4{ambient_, 0.f},
+				// Minus the view space z.
+				.viewDepth = -glm::vec4{view[0][2], view[1][2], view[2][2], view[3][2]},
+				.tileScale = glm::vec2{
+					static_cast<float>(LightClusters::TilesX) / static_cast<float>(camera_.viewportWidth),
+					static_cast<float>(LightClusters::TilesY) / static_cast<float>(camera_.viewportHeight)
+				},
+				.sliceScaleBias = glm::vec2{lightClusters_.getSliceScale(), lightClusters_.getSliceBias()},
+				.clusterSize = glm::uvec4{LightClusters::TilesX, LightClusters::TilesY, LightClusters::Slices, 0}
 			});
 		}
 
-		void setupLinesPipeline(SDL_GPUDevice* gpuDevice, SDL_GPUSampleCount gpuSampleCount) {
-			SDL_GPUVertexBufferDescription vertexBufferDescriptions{
-				.slot = 0,
-				.pitch = sizeof(Vertex),
-				.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX
-			};
+	private:
+		// The state shared by all pipelines: one color target, the depth buffer and the sample
+		// count given to preLoop. Blending is for transparent geometry, drawn after the opaque.
+		sdl::GpuGraphicsPipeline createGraphicsPipeline(SDL_GPUDevice* gpuDevice, SDL_GPUShader* vertexShader, SDL_GPUShader* fragmentShader,
+			const SDL_GPUVertexInputState& vertexInputState, SDL_GPUPrimitiveType primitiveType, bool blend, bool depthWrite,
+			SDL_GPUCullMode cullMode = SDL_GPU_CULLMODE_NONE) const {
 
 			SDL_GPUColorTargetDescription colorTargetDescription{
 				.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
@@ -122,8 +1428,8 @@ namespace robot {
 					.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
 					.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
 					.alpha_blend_op = SDL_GPU_BLENDOP_ADD,
-					.enable_blend = true
-			}
+					.enable_blend = blend
+				}
 			};
 
 			SDL_GPUDepthStencilState depthStencilState{
@@ -135,30 +1441,30 @@ namespace robot {
 					.compare_op = SDL_GPU_COMPAREOP_ALWAYS,
 				},
 				.front_stencil_state = {
-						.fail_op = SDL_GPU_STENCILOP_KEEP,
-						.pass_op = SDL_GPU_STENCILOP_KEEP,
-						.depth_fail_op = SDL_GPU_STENCILOP_KEEP,
-						.compare_op = SDL_GPU_COMPAREOP_ALWAYS,
+					.fail_op = SDL_GPU_STENCILOP_KEEP,
+					.pass_op = SDL_GPU_STENCILOP_KEEP,
+					.depth_fail_op = SDL_GPU_STENCILOP_KEEP,
+					.compare_op = SDL_GPU_COMPAREOP_ALWAYS,
 				},
 				.compare_mask = 0,
 				.write_mask = 0,
 				.enable_depth_test = true,
-				.enable_depth_write = true,
+				.enable_depth_write = depthWrite,
 				.enable_stencil_test = false
 			};
 
 			SDL_GPUGraphicsPipelineCreateInfo pipelineInfo{
-				.vertex_shader = shader_.vertexShader.get(),
-				.fragment_shader = shader_.fragmentShader.get(),
-				.vertex_input_state = SDL_GPUVertexInputState{
-					.vertex_buffer_descriptions = &vertexBufferDescriptions,
-					.num_vertex_buffers = 1,
-					.vertex_attributes = shader_.attributes.data(),
-					.num_vertex_attributes = static_cast<Uint32>(shader_.attributes.size())
+				.vertex_shader = vertexShader,
+				.fragment_shader = fragmentShader,
+				.vertex_input_state = vertexInputState,
+				.primitive_type = primitiveType,
+				.rasterizer_state = SDL_GPURasterizerState{
+					.fill_mode = SDL_GPU_FILLMODE_FILL,
+					.cull_mode = cullMode,
+					.front_face = SDL_GPU_FRONTFACE_COUNTER_CLOCKWISE
 				},
-				.primitive_type = SDL_GPU_PRIMITIVETYPE_LINELIST,
 				.multisample_state = SDL_GPUMultisampleState{
-						.sample_count = gpuSampleCount
+					.sample_count = gpuSampleCount_
 				},
 				.depth_stencil_state = depthStencilState,
 				.target_info = SDL_GPUGraphicsPipelineTargetInfo{
@@ -168,546 +1474,367 @@ namespace robot {
 					.has_depth_stencil_target = true
 				}
 			};
-			linesPipeline_ = sdl::createGpuGraphicsPipeline(gpuDevice, pipelineInfo);
+			return sdl::createGpuGraphicsPipeline(gpuDevice, pipelineInfo);
 		}
 
-		void setupTrianglesPipeline(SDL_GPUDevice* gpuDevice, SDL_GPUSampleCount gpuSampleCount) {
-			SDL_GPUVertexBufferDescription vertexBufferDescriptions{
+		// Triangles or lines in the Vertex layout. Transparent geometry is blended over the
+		// opaque geometry, tested against the depth but not written to it.
+		sdl::GpuGraphicsPipeline createPipeline(SDL_GPUDevice* gpuDevice, SDL_GPUPrimitiveType primitiveType, uint32_t variant, bool transparent) {
+			SDL_GPUVertexBufferDescription vertexBufferDescription{
 				.slot = 0,
 				.pitch = sizeof(Vertex),
 				.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX
 			};
-
-			SDL_GPUColorTargetDescription colorTargetDescription{
-				.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-				.blend_state = SDL_GPUColorTargetBlendState{
-					.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-					.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-					.color_blend_op = SDL_GPU_BLENDOP_ADD,
-					.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-					.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-					.alpha_blend_op = SDL_GPU_BLENDOP_ADD,
-					.enable_blend = true
-				}
-			};
-
-			SDL_GPUDepthStencilState depthStencilState{
-				.compare_op = SDL_GPU_COMPAREOP_LESS,
-				.back_stencil_state = {
-					.fail_op = SDL_GPU_STENCILOP_KEEP,
-					.pass_op = SDL_GPU_STENCILOP_KEEP,
-					.depth_fail_op = SDL_GPU_STENCILOP_KEEP,
-					.compare_op = SDL_GPU_COMPAREOP_ALWAYS,
-				},
-				.front_stencil_state = {
-						.fail_op = SDL_GPU_STENCILOP_KEEP,
-						.pass_op = SDL_GPU_STENCILOP_KEEP,
-						.depth_fail_op = SDL_GPU_STENCILOP_KEEP,
-						.compare_op = SDL_GPU_COMPAREOP_ALWAYS,
-				},
-				.compare_mask = 0,
-				.write_mask = 0,
-				.enable_depth_test = true,
-				.enable_depth_write = true,
-				.enable_stencil_test = false
+			SDL_GPUVertexInputState vertexInputState{
+				.vertex_buffer_descriptions = &vertexBufferDescription,
+				.num_vertex_buffers = 1,
+				.vertex_attributes = shader_.attributes.data(),
+				.num_vertex_attributes = static_cast<Uint32>(shader_.attributes.size())
 			};
+			return createGraphicsPipeline(gpuDevice, shader_.getVertexShader(variant), shader_.getFragmentShader(variant),
+				vertexInputState, primitiveType, transparent, !transparent);
+		}
 
-			SDL_GPUGraphicsPipelineCreateInfo pipelineInfo{
-				.vertex_shader = shader_.vertexShader.get(),
-				.fragment_shader = shader_.fragmentShader.get(),
-				.vertex_input_state = SDL_GPUVertexInputState{
-					.vertex_buffer_descriptions = &vertexBufferDescriptions,
-					.num_vertex_buffers = 1,
-					.vertex_attributes = shader_.attributes.data(),
-					.num_vertex_attributes = static_cast<Uint32>(shader_.attributes.size())
-				},
-				.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
-				.multisample_state = SDL_GPUMultisampleState{
-					.sample_count = gpuSampleCount
+		// Cached meshes with one InstanceData per instance, blended as createPipeline.
+		sdl::GpuGraphicsPipeline createInstancedPipeline(SDL_GPUDevice* gpuDevice, uint32_t variant, bool transparent) {
+			std::array<SDL_GPUVertexBufferDescription, 2> vertexBufferDescriptions{
+				SDL_GPUVertexBufferDescription{
+					.slot = 0,
+					.pitch = sizeof(MeshVertex),
+					.input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX
 				},
-				.depth_stencil_state = depthStencilState,
-				.target_info = SDL_GPUGraphicsPipelineTargetInfo{
-					.color_target_descriptions = &colorTargetDescription,
-					.num_color_targets = 1,
-					.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D32_FLOAT,
-					.has_depth_stencil_target = true
+				SDL_GPUVertexBufferDescription{
+					.slot = 1,
+					.pitch = sizeof(InstanceData),
+					.input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE
 				}
 			};
-			trianglesPipeline_ = sdl::createGpuGraphicsPipeline(gpuDevice, pipelineInfo);
-		}
-
-		void pushMatrix() {
-			matrices_.push(matrices_.top());
+			SDL_GPUVertexInputState vertexInputState{
+				.vertex_buffer_descriptions = vertexBufferDescriptions.data(),
+				.num_vertex_buffers = static_cast<Uint32>(vertexBufferDescriptions.size()),
+				.vertex_attributes = shader_.instancedAttributes.data(),
+				.num_vertex_attributes = static_cast<Uint32>(shader_.instancedAttributes.size())
+			};
+			return createGraphicsPipeline(gpuDevice, shader_.instancedVertexShader.get(), shader_.getFragmentShader(variant),
+				vertexInputState, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, transparent, !transparent);
 		}
 
-		void popMatrix() {
-			if (matrices_.size() > 1) {
-				matrices_.pop();
-			}
+		// One ImpostorInstance per instance, the box corners come from the vertex id. The front
+		// faces are culled, the back faces are drawn even with the camera inside the box.
+		sdl::GpuGraphicsPipeline createImpostorPipeline(SDL_GPUDevice* gpuDevice, uint32_t variant) {
+			SDL_GPUVertexBufferDescription vertexBufferDescription{
+				.slot = 0,
+				.pitch = sizeof(ImpostorInstance),
+				.input_rate = SDL_GPU_VERTEXINPUTRATE_INSTANCE
+			};
+			SDL_GPUVertexInputState vertexInputState{
+				.vertex_buffer_descriptions = &vertexBufferDescription,
+				.num_vertex_buffers = 1,
+				.vertex_attributes = shader_.impostorAttributes.data(),
+				.num_vertex_attributes = static_cast<Uint32>(shader_.impostorAttributes.size())
+			};
+			return createGraphicsPipeline(gpuDevice, shader_.impostorVertexShader.get(), shader_.getImpostorFragmentShader(variant),
+				vertexInputState, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, false, true, SDL_GPU_CULLMODE_FRONT);
 		}
 
-		void loadIdentityMatrix() {
-			while (!matrices_.empty()) {
-				matrices_.pop();
+		// Every variant up front, creating a pipeline while drawing stalls the frame. Called
+		// again by preLoop, the new pipelines replace the ones of the old sample count.
+		void createPipelines(SDL_GPUDevice* gpuDevice) {
+			for (uint32_t variant = 0; variant < ShaderVariant::Count; ++variant) {
+				if (ShaderVariant::get(variant) != variant) {
+					continue;	// Never drawn, clip space is always unlit.
+				}
+				trianglesPipelines_[variant] = createPipeline(gpuDevice, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, variant, false);
+				transparentTrianglesPipelines_[variant] = createPipeline(gpuDevice, SDL_GPU_PRIMITIVETYPE_TRIANGLELIST, variant, true);
+				linesPipelines_[variant] = createPipeline(gpuDevice, SDL_GPU_PRIMITIVETYPE_LINELIST, variant, false);
+				instancedPipelines_[variant] = createInstancedPipeline(gpuDevice, variant, false);
+				transparentInstancedPipelines_[variant] = createInstancedPipeline(gpuDevice, variant, true);
+				impostorPipelines_[variant] = createImpostorPipeline(gpuDevice, variant);
 			}
-			matrices_.push(glm::mat4{1.0f});
 		}
 
-		void translate(const glm::vec3& translation) {
-			matrices_.top() = glm::translate(matrices_.top(), translation);
+		SDL_GPUGraphicsPipeline* getTrianglesPipeline(uint32_t variant, bool transparent) const {
+			return (transparent ? transparentTrianglesPipelines_ : trianglesPipelines_)[variant].get();
 		}
 
-		void rotate(float angleRadians, const glm::vec3& axis) {
-			matrices_.top() = glm::rotate(matrices_.top(), angleRadians, axis);
+		SDL_GPUGraphicsPipeline* getLinesPipeline(uint32_t variant) const {
+			return linesPipelines_[variant].get();
 		}
 
-		void scale(const glm::vec3& scale) {
-			matrices_.top() = glm::scale(matrices_.top(), scale);
+		SDL_GPUGraphicsPipeline* getInstancedPipeline(uint32_t variant, bool transparent) const {
+			return (transparent ? transparentInstancedPipelines_ : instancedPipelines_)[variant].get();
 		}
 
-		void multiplyMatrix(const glm::mat4& matrix) {
-			matrices_.top() = matrices_.top() * matrix;
+		SDL_GPUGraphicsPipeline* getImpostorPipeline(uint32_t variant) const {
+			return impostorPipelines_[variant].get();
 		}
 
-		const glm::mat4& getMatrix() const {
-			return matrices_.top();
-		}
+		// The shape is drawn in the sorted transparent geometry, after the upload of its batch.
+		void addTransparentShape(uint32_t variant, const TransparentShape& shape, const glm::vec3& center, SDL_GPUGraphicsPipeline* pipeline,
+			SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t transformOffset) {
 
-		void addSolidCube(float size, sdl::Color color) {
-			trianglesBuffer_.batch().startBatch();
-			
-			float halfSize = size / 2.0f;
-			
-			// Back face (normal pointing in -Z direction)
-			glm::vec4 normalBack{0.0f, 0.0f, -1.0f, 0.0f};
-			addVertex(glm::vec3{-halfSize, -halfSize, -halfSize}, NoTexture, color, normalBack);
-			addVertex(glm::vec3{halfSize, -halfSize, -halfSize}, NoTexture, color, normalBack);
-			addVertex(glm::vec3{halfSize, halfSize, -halfSize}, NoTexture, color, normalBack);
-			addVertex(glm::vec3{-halfSize, halfSize, -halfSize}, NoTexture, color, normalBack);
-			
-			// Front face (normal pointing in +Z direction)
-			glm::vec4 normalFront{0.0f, 0.0f, 1.0f, 0.0f};
-			addVertex(glm::vec3{-halfSize, -halfSize, halfSize}, NoTexture, color, normalFront);
-			addVertex(glm::vec3{halfSize, -halfSize, halfSize}, NoTexture, color, normalFront);
-			addVertex(glm::vec3{halfSize, halfSize, halfSize}, NoTexture, color, normalFront);
-			addVertex(glm::vec3{-halfSize, halfSize, halfSize}, NoTexture, color, normalFront);
-			
-			// Left face (normal pointing in -X direction)
-			glm::vec4 normalLeft{-1.0f, 0.0f, 0.0f, 0.0f};
-			addVertex(glm::vec3{-halfSize, -halfSize, -halfSize}, NoTexture, color, normalLeft);
-			addVertex(glm::vec3{-halfSize, -halfSize, halfSize}, NoTexture, color, normalLeft);
-			addVertex(glm::vec3{-halfSize, halfSize, halfSize}, NoTexture, color, normalLeft);
-			addVertex(glm::vec3{-halfSize, halfSize, -halfSize}, NoTexture, color, normalLeft);
-			
-			// Right face (normal pointing in +X direction)
-			glm::vec4 normalRight{1.0f, 0.0f, 0.0f, 0.0f};
-			addVertex(glm::vec3{halfSize, -halfSize, -halfSize}, NoTexture, color, normalRight);
-			addVertex(glm::vec3{halfSize, -halfSize, halfSize}, NoTexture, color, normalRight);
-			addVertex(glm::vec3{halfSize, halfSize, halfSize}, NoTexture, color, normalRight);
-			addVertex(glm::vec3{halfSize, halfSize, -halfSize}, NoTexture, color, normalRight);
-			
-			// Top face (normal pointing in +Y direction)
-			glm::vec4 normalTop{0.0f, 1.0f, 0.0f, 0.0f};
-			addVertex(glm::vec3{-halfSize, halfSize, -halfSize}, NoTexture, color, normalTop);
-			addVertex(glm::vec3{halfSize, halfSize, -halfSize}, NoTexture, color, normalTop);
-			addVertex(glm::vec3{halfSize, halfSize, halfSize}, NoTexture, color, normalTop);
-			addVertex(glm::vec3{-halfSize, halfSize, halfSize}, NoTexture, color, normalTop);
-			
-			// Bottom face (normal pointing in -Y direction)
-			glm::vec4 normalBottom{0.0f, -1.0f, 0.0f, 0.0f};
-			addVertex(glm::vec3{-halfSize, -halfSize, -halfSize}, NoTexture, color, normalBottom);
-			addVertex(glm::vec3{halfSize, -halfSize, -halfSize}, NoTexture, color, normalBottom);
-			addVertex(glm::vec3{halfSize, -halfSize, halfSize}, NoTexture, color, normalBottom);
-			addVertex(glm::vec3{-halfSize, -halfSize, halfSize}, NoTexture, color, normalBottom);
-
-			trianglesBuffer_.batch().insertIndices({
-				0, 1, 2, 2, 3, 0,		// Back face
-				4, 5, 6, 6, 7, 4,		// Front face
-				8, 9, 10, 10, 11, 8,	// Left face
-				12, 13, 14, 14, 15, 12,	// Right face
-				16, 17, 18, 18, 19, 16,	// Top face
-				20, 21, 22, 22, 23, 20	// Bottom face
+			if (shape.indexCount == 0) {
+				return;
+			}
+			transparentShapeDraws_.push_back(ShapeDraw{
+				.variant = variant,
+				.center = center,
+				.triangles = TriangleRange{
+					.pipeline = pipeline,
+					.vertexBuffer = vertexBuffer,
+					.indexBuffer = indexBuffer,
+					.transformOffset = transformOffset,
+					.firstIndex = shape.firstIndex,
+					.indexCount = shape.indexCount
+				}
 			});
 		}
 
-		void addSolidSphere(float radius, unsigned int slices, unsigned int stacks, sdl::Color color, DrawMode drawMode = DrawMode::Light) {
-			trianglesBuffer_.batch().startBatch();
-
-			// Top vertex
-			glm::vec3 topPos{0.0f, radius, 0.0f};
-			glm::vec4 topNormal{0.0f, 1.0f, 0.0f, 0.0f};
-			addVertex(topPos, NoTexture, color, topNormal, drawMode);
-
-			// Generate vertices for each stack
-			for (unsigned int stack = 1; stack < stacks; ++stack) {
-				float stackAngle = Pi / 2.0f - Pi * stack / stacks;
-				float xy = radius * std::cos(stackAngle);
-				float y = radius * std::sin(stackAngle);
-
-				for (unsigned int slice = 0; slice <= slices; ++slice) {
-					float sliceAngle = 2.0f * Pi * slice / slices;
-					float x = xy * std::cos(sliceAngle);
-					float z = xy * std::sin(sliceAngle);
-
-					glm::vec3 pos{x, y, z};
-					glm::vec4 normal{glm::normalize(glm::vec3{x, y, z}), 0.0f};
-					addVertex(pos, NoTexture, color, normal, drawMode);
+		// Orders the meshes by their variant and nearest opaque instance, and the transparent
+		// instances of all meshes and the transparent shapes back to front. The instances are
+		// drawn in runs of the same mesh, the shapes in runs of adjacent indices.
+		void sortInstances() {
+			const glm::vec3 eye{glm::inverse(camera_.view)[3]};
+			opaqueMeshes_.clear();
+			transparentOrder_.clear();
+			for (uint32_t variant = 0; variant < ShaderVariant::Count; ++variant) {
+				for (auto& [mesh, instancedMesh] : instancedMeshes_[variant]) {
+					const float distance = instancedMesh.sort(eye, frameArena_);
+					if (instancedMesh.getOpaqueCount() > 0) {
+						opaqueMeshes_.push_back(OpaqueMesh{variant, distance, &instancedMesh});
+					}
+					const auto centers = instancedMesh.getTransparentCenters();
+					for (uint32_t i = 0; i < centers.size(); ++i) {
+						transparentOrder_.push_back(TransparentInstance{glm::length(centers[i] - eye), variant, &instancedMesh, i});
+					}
 				}
 			}
-
-			// Bottom vertex
-			glm::vec3 bottomPos{0.0f, -radius, 0.0f};
-			glm::vec4 bottomNormal{0.0f, -1.0f, 0.0f, 0.0f};
-			addVertex(bottomPos, NoTexture, color, bottomNormal, drawMode);
-
-			// Generate indices for top cap
-			for (unsigned int slice = 0; slice < slices; ++slice) {
-				trianglesBuffer_.batch().insertIndices({
-					0, slice + 1, slice + 2
-				});
+			for (uint32_t i = 0; i < transparentShapeDraws_.size(); ++i) {
+				const auto& shape = transparentShapeDraws_[i];
+				transparentOrder_.push_back(TransparentInstance{glm::length(shape.center - eye), shape.variant, nullptr, i});
 			}
+			// The variant first, it changes the pipeline.
+			std::sort(opaqueMeshes_.begin(), opaqueMeshes_.end(), [](const OpaqueMesh& a, const OpaqueMesh& b) {
+				return a.variant != b.variant ? a.variant < b.variant : a.distance < b.distance;
+			});
+			std::sort(transparentOrder_.begin(), transparentOrder_.end(), [](const TransparentInstance& a, const TransparentInstance& b) {
+				return a.distance > b.distance;
+			});
 
-			// Generate indices for middle stacks
-			for (unsigned int stack = 0; stack < stacks - 2; ++stack) {
-				unsigned int k1 = 1 + stack * (slices + 1);
-				unsigned int k2 = k1 + slices + 1;
-
-				for (unsigned int slice = 0; slice < slices; ++slice) {
-					trianglesBuffer_.batch().insertIndices({
-						k1 + slice, k2 + slice, k2 + slice + 1,
-						k2 + slice + 1, k1 + slice + 1, k1 + slice
-					});
+			transparentInstances_.clear();
+			transparentRuns_.clear();
+			for (auto [distance, variant, instancedMesh, index] : transparentOrder_) {
+				if (instancedMesh == nullptr) {
+					const auto& triangles = transparentShapeDraws_[index].triangles;
+					if (!transparentRuns_.empty() && transparentRuns_.back().mesh == nullptr) {
+						auto& previous = transparentShapeDraws_[transparentRuns_.back().first].triangles;
+						if (previous.indexBuffer == triangles.indexBuffer && previous.pipeline == triangles.pipeline
+							&& previous.transformOffset == triangles.transformOffset && previous.firstIndex + previous.indexCount == triangles.firstIndex) {
+							previous.indexCount += triangles.indexCount;
+							continue;
+						}
+					}
+					transparentRuns_.push_back(TransparentRun{variant, nullptr, index, 1});
+					continue;
 				}
-			}
-
-			// Generate indices for bottom cap
-			unsigned int bottomVertex = 1 + (stacks - 1) * (slices + 1);
-			unsigned int lastStackStart = 1 + (stacks - 2) * (slices + 1);
-			for (unsigned int slice = 0; slice < slices; ++slice) {
-				trianglesBuffer_.batch().insertIndices({
-					lastStackStart + slice, bottomVertex, lastStackStart + slice + 1
-				});
+				if (transparentRuns_.empty() || transparentRuns_.back().mesh != instancedMesh) {
+					transparentRuns_.push_back(TransparentRun{variant, instancedMesh, static_cast<Uint32>(transparentInstances_.size()), 0});
+				}
+				++transparentRuns_.back().count;
+				transparentInstances_.push_back(instancedMesh->getTransparentInstances()[index]);
 			}
 		}
 
-		void addRectangle(const glm::vec2& pos, const glm::vec2& size, sdl::Color color) {
-			glm::vec3 pos3{pos, 0.0f};
-			glm::vec3 normal = glm::vec3{0.0f, 0.0f, 1.0f};
-
-			trianglesBuffer_.batch().startBatch();
-			addVertex(pos3, NoTexture, color, normal);
-			addVertex({pos3.x + size.x, pos3.y, pos3.z}, NoTexture, color, normal);
-			addVertex({pos3.x + size.x, pos3.y + size.y, pos3.z}, NoTexture, color, normal);
-			addVertex({pos3.x, pos3.y + size.y, pos3.z}, NoTexture, color, normal);
-
-			trianglesBuffer_.batch().insertIndices({
-				0, 1, 2,
-				2, 3, 0 
+		void drawFloor(SDL_GPUCommandBuffer* commandBuffer, SDL_GPURenderPass* renderPass) {
+			const glm::mat4 viewProjection = camera_.projection * camera_.view;
+			shader_.uploadFloorData(commandBuffer, FloorUniforms{
+				.viewProjection = viewProjection,
+				.inverseViewProjection = glm::inverse(viewProjection),
+				.color1 = floor_->color1,
+				.color2 = floor_->color2,
+				.lineColor = floor_->lineColor,
+				.cellSize = floor_->cellSize,
+				.lineSpacing = floor_->lineSpacing,
+				.lineWidth = floor_->lineWidth,
+				.fadeDistance = floor_->fadeDistance
 			});
+			SDL_BindGPUGraphicsPipeline(renderPass, floorPipeline_.get());
+			bindFragmentResources(renderPass);
+			SDL_DrawGPUPrimitives(renderPass, 3, 1, 0, 0);
 		}
 
-		void clear() {
-			trianglesBuffer_.batch().clear();
-		}
-
-		void addLine(const glm::vec3& p1, const glm::vec3& p2, float pixelSize, sdl::Color color, int viewportWidth, int viewportHeight) {
-			// Transform to clip space
-			glm::vec4 cp1 = projectionMatrix_ * viewMatrix_ * glm::vec4(p1, 1.0f);
-			glm::vec4 cp2 = projectionMatrix_ * viewMatrix_ * glm::vec4(p2, 1.0f);
-
-			// Avoid degenerate W
-			if (cp1.w == 0.0f || cp2.w == 0.0f)
-				return;
-
-			// Convert to NDC
-			glm::vec3 ndc1 = glm::vec3(cp1) / cp1.w;
-			glm::vec3 ndc2 = glm::vec3(cp2) / cp2.w;
-
-			// 2D direction in NDC
-			glm::vec2 dir = glm::vec2(ndc2 - ndc1);
-			float len = glm::length(dir);
-			if (len < 1e-6f)
-				return; // Line parallel to camera view axis; zero screen length.
-
-			// Perpendicular in NDC
-			glm::vec2 offset = 0.5f * glm::normalize(glm::vec2{-dir.y, dir.x});
-			offset.x *= (pixelSize / viewportWidth);
-			offset.y *= (pixelSize / viewportHeight);
-
-			// Build quad in clip space
-			glm::vec3 p11{ndc1.x - offset.x, ndc1.y - offset.y, ndc1.z};
-			glm::vec3 p22{ndc2.x - offset.x, ndc2.y - offset.y, ndc2.z};
-			glm::vec3 p33{ndc2.x + offset.x, ndc2.y + offset.y, ndc2.z};
-			glm::vec3 p44{ndc1.x + offset.x, ndc1.y + offset.y, ndc1.z};
+		void drawTriangles(SDL_GPUCommandBuffer* commandBuffer, SDL_GPURenderPass* renderPass, const TriangleRange& triangles) {
+			SDL_BindGPUGraphicsPipeline(renderPass, triangles.pipeline);
+			SDL_BindGPUVertexStorageBuffers(renderPass, 0, &transformsGpuBuffer_, 1);
+			shader_.uploadTransformOffset(commandBuffer, triangles.transformOffset);
 
-			trianglesBuffer_.batch().startBatch();
-
-			addVertex(p11, NoProjection, color, {}, DrawMode::Light);
-			addVertex(p22, NoProjection, color, {}, DrawMode::Light);
-			addVertex(p33, NoProjection, color, {}, DrawMode::Light);
-			addVertex(p44, NoProjection, color, {}, DrawMode::Light);
-
-			trianglesBuffer_.batch().insertIndices({0, 1, 2, 2, 3, 0});
-		}
-
-		void addCircle(const glm::vec2& center, float radius, sdl::Color color, unsigned int iterations = 30, float startAngle = 0) {
-			trianglesBuffer_.batch().startBatch();
+			SDL_GPUBufferBinding vertexBinding{
+				.buffer = triangles.vertexBuffer,
+				.offset = 0
+			};
+			SDL_BindGPUVertexBuffers(
+				renderPass,
+				0,
+				&vertexBinding,
+				1
+			);
 
-			// Add center vertex
-			addVertex(glm::vec3{center, 0.0f}, NoTexture, color);
+			SDL_GPUBufferBinding indexBinding{
+				.buffer = triangles.indexBuffer,
+				.offset = 0
+			};
+			SDL_BindGPUIndexBuffer(
+				renderPass,
+				&indexBinding,
+				SDL_GPU_INDEXELEMENTSIZE_32BIT
+			);
 
-			// Add perimeter vertices
-			for (unsigned int i = 0; i <= iterations; ++i) {
-				float angle = startAngle + (2.0f * Pi * i) / iterations;
-				glm::vec2 pos = center + radius * glm::vec2{std::cos(angle), std::sin(angle)};
-				addVertex(glm::vec3{pos, 0.0f}, NoTexture, color);
-			}
+			bindFragmentResources(renderPass);
 
-			// Create triangles from center to perimeter
-			for (unsigned int i = 0; i < iterations; ++i) {
-				trianglesBuffer_.batch().insertIndices({
-					0, i + 1, i + 2
-				});
-			}
+			SDL_DrawGPUIndexedPrimitives(
+				renderPass,
+				triangles.indexCount,
+				1,
+				triangles.firstIndex,
+				0,
+				0
+			);
 		}
 
-		void addCircleOutline(const glm::vec2& center, float radius, float width, sdl::Color color, unsigned int iterations = 30, float startAngle = 0) {
-			trianglesBuffer_.batch().startBatch();
-
-			float innerRadius = radius - width * 0.5f;
-			float outerRadius = radius + width * 0.5f;
-
-			// Add vertices for inner and outer circles
-			for (unsigned int i = 0; i <= iterations; ++i) {
-				float angle = startAngle + (2.0f * Pi * i) / iterations;
-				glm::vec2 direction{std::cos(angle), std::sin(angle)};
-
-				glm::vec2 innerPos = center + innerRadius * direction;
-				glm::vec2 outerPos = center + outerRadius * direction;
-
-				addVertex(glm::vec3{innerPos, 0.0f}, NoTexture, color);
-				addVertex(glm::vec3{outerPos, 0.0f}, NoTexture, color);
-			}
-
-			// Create quad strips between inner and outer circles
-			for (unsigned int i = 0; i < iterations; ++i) {
-				unsigned int baseIndex = i * 2;
-				trianglesBuffer_.batch().insertIndices({
-					baseIndex, baseIndex + 1, baseIndex + 3,
-					baseIndex + 3, baseIndex + 2, baseIndex
-				});
-			}
+		// The texture sampler and the light buffers, bound again after each pipeline.
+		void bindFragmentResources(SDL_GPURenderPass* renderPass) {
+			SDL_GPUTextureSamplerBinding samplerBinding{
+				.texture = texture_.get(),
+				.sampler = sampler_.get()
+			};
+			SDL_BindGPUFragmentSamplers(
+				renderPass,
+				0,
+				&samplerBinding,
+				1
+			);
+			std::array storageBuffers{lightsGpuBuffer_, clustersGpuBuffer_, lightIndicesGpuBuffer_};
+			SDL_BindGPUFragmentStorageBuffers(renderPass, 0, storageBuffers.data(), static_cast<Uint32>(storageBuffers.size()));
 		}
 
-		void addPolygon(std::initializer_list<glm::vec2> points, sdl::Color color) {
-			addPolygon(points.begin(), points.end(), color);
-		}
+		// Assigns the lights to the clusters and uploads the storage buffers of the fragment shader.
+		void uploadLights(SDL_GPUDevice* gpuDevice) {
+			lightClusters_.update(camera_.view, camera_.projection, lightSpheres_);
 
-		void addPolygon(std::input_iterator auto begin, std::input_iterator auto end, sdl::Color color) {
-			trianglesBuffer_.batch().startBatch();
-			for (auto it = begin; it != end; ++it) {
-				addVertex(glm::vec3{*it, 0.f}, NoTexture, color);
+			// Storage buffers can't be empty.
+			static const GpuLight NoLight{};
+			static const uint32_t NoLightIndex = 0;
+			std::span<const GpuLight> lights = lights_;
+			if (lights.empty()) {
+				lights = {&NoLight, 1};
 			}
-			const auto size = std::distance(begin, end);
-			for (unsigned int i = 1; i < size - 1; ++i) {
-				trianglesBuffer_.batch().insertIndices({0, i, i + 1});
+			std::span<const uint32_t> lightIndices = lightClusters_.getLightIndices();
+			if (lightIndices.empty()) {
+				lightIndices = {&NoLightIndex, 1};
 			}
+			auto clusters = lightClusters_.getClusters();
+
+			lightsGpuBuffer_ = lightsBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, lights);
+			clustersGpuBuffer_ = clustersBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, clusters);
+			lightIndicesGpuBuffer_ = lightIndicesBuffer_.get(gpuDevice, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, lightIndices);
+			uploadRing_.upload(lights, lightsGpuBuffer_, true);
+			uploadRing_.upload(clusters, clustersGpuBuffer_, true);
+			uploadRing_.upload(lightIndices, lightIndicesGpuBuffer_, true);
 		}
 
-		void addCylinder(float baseRadius, float topRadius, float height, unsigned int slices, unsigned int stacks, sdl::Color color) {
-			trianglesBuffer_.batch().startBatch();
-
-			// Generate vertices for side faces
-			for (unsigned int stack = 0; stack <= stacks; ++stack) {
-				float stackHeight = height * stack / stacks;
-				float stackRadius = baseRadius + (topRadius - baseRadius) * stack / stacks;
-				for (unsigned int slice = 0; slice <= slices; ++slice) {
-
-					float angle = 2.0f * Pi * slice / slices;
-					float x = stackRadius * std::cos(angle);
-					float y = stackRadius * std::sin(angle);
-					float z = stackHeight;
-
-					// Normal perpendicular to cylinder surface (radial direction in XY plane)
-					glm::vec3 normalDir{std::cos(angle), std::sin(angle), 0.0f};
-					addVertex(glm::vec3{x, y, z}, NoTexture, color, normalDir);
-				}
-			}
-
-			// Generate indices for side faces
-			for (unsigned int stack = 0; stack < stacks; ++stack) {
-				for (unsigned int slice = 0; slice < slices; ++slice) {
-					unsigned int current = stack * (slices + 1) + slice;
-					unsigned int next = current + slices + 1;
-
-					trianglesBuffer_.batch().insertIndices({
-						current, next, next + 1,
-						next + 1, current + 1, current
-					});
-				}
-			}
-			
-			// Bottom cap (base at Z=0)
-			unsigned int vertexOffset = (stacks + 1) * (slices + 1);
-			glm::vec3 bottomNormal{0.0f, 0.0f, -1.0f};
-			addVertex(glm::vec3{0.0f, 0.0f, 0.0f}, NoTexture, color, bottomNormal);
-
-			for (unsigned int slice = 0; slice <= slices; ++slice) {
-				float angle = 2.0f * Pi * slice / slices;
-				float x = baseRadius * std::cos(angle);
-				float y = baseRadius * std::sin(angle);
-				addVertex(glm::vec3{x, y, 0.0f}, NoTexture, color, bottomNormal);
-			}
-
-			// Bottom cap indices
-			for (unsigned int slice = 0; slice < slices; ++slice) {
-				trianglesBuffer_.batch().insertIndices({
-					vertexOffset, vertexOffset + slice + 1, vertexOffset + slice + 2
-				});
-			}
-
-			// Top cap (at Z=height)
-			vertexOffset += slices + 2;
-			glm::vec3 topNormal{0.0f, 0.0f, 1.0f};
-			addVertex(glm::vec3{0.0f, 0.0f, height}, NoTexture, color, topNormal);
-
-			for (unsigned int slice = 0; slice <= slices; ++slice) {
-				float angle = 2.0f * Pi * slice / slices;
-				float x = topRadius * std::cos(angle);
-				float y = topRadius * std::sin(angle);
-				addVertex(glm::vec3{x, y, height}, NoTexture, color, topNormal);
-			}
-
-			// Top cap indices - reversed winding order from bottom
-			for (unsigned int slice = 0; slice < slices; ++slice) {
-				trianglesBuffer_.batch().insertIndices({
-					vertexOffset, vertexOffset + slice + 2, vertexOffset + slice + 1
-				});
+		// The instances, lines and impostors of the builder go to the instanced meshes and the batches.
+		void merge(const GeometryBuilder& builder) {
+			for (const auto& built : builder.instances_) {
+				auto& instancedMeshes = instancedMeshes_[built.variant];
+				auto it = built.gpuMesh != nullptr
+					? instancedMeshes.try_emplace(built.gpuMesh, *built.gpuMesh).first
+					: instancedMeshes.try_emplace(built.mesh, *built.mesh).first;
+				it->second.addInstance(built.instance, built.center, built.radius);
 			}
-		}
-
-		void addPixel(const glm::vec2& point, sdl::Color color, float size = 1.f) {
-			addRectangle(point - glm::vec2{size * 0.5f}, glm::vec2{size}, color);
-		}
-
-		void bindAndDraw(SDL_GPUDevice* gpuDevice, SDL_GPURenderPass* renderPass) {
-			for (const auto& data : gpuDatas_) {
-				SDL_GPUTextureSamplerBinding samplerBinding{
-					.texture = texture_.get(),
-					.sampler = sampler_.get()
-				};
-
-				SDL_BindGPUGraphicsPipeline(renderPass, trianglesPipeline_.get());
-
-				SDL_GPUBufferBinding vertexBinding{
-					.buffer = data.vertexBuffer,
-					.offset = 0
-				};
-				SDL_BindGPUVertexBuffers(
-					renderPass,
-					0,
-					&vertexBinding,
-					1
-				);
-
-				SDL_GPUBufferBinding indexBinding{
-					.buffer = data.indexBuffer,
-					.offset = 0
-				};
-				SDL_BindGPUIndexBuffer(
-					renderPass,
-					&indexBinding,
-					SDL_GPU_INDEXELEMENTSIZE_32BIT
-				);
-
-				SDL_BindGPUFragmentSamplers(
-					renderPass,
-					0,
-					&samplerBinding,
-					1
-				);
-
-				SDL_DrawGPUIndexedPrimitives(
-					renderPass,
-					static_cast<Uint32>(data.indices.size()),
-					1,
-					0,
-					0,
-					0
-				);
+			for (const auto& line : builder.lines_) {
+				lineBatch_.add(line);
 			}
-			gpuDatas_.clear();
-		}
-
-		void gpuCopyPass(SDL_GPUDevice* gpuDevice, SDL_GPUCommandBuffer* commandBuffer) {
-			gpuDatas_.emplace_back(trianglesBuffer_.prepareGpuData(gpuDevice, trianglesPipeline_.get()));
-
-			SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
-			for (const auto& gpuData : gpuDatas_) {
-				SDL_GPUTransferBufferLocation vertexLocation{
-					.transfer_buffer = gpuData.vertexTransferBuffer,
-					.offset = 0
-				};
-				SDL_GPUBufferRegion vertexRegion{
-					.buffer = gpuData.vertexBuffer,
-					.offset = 0,
-					.size = static_cast<Uint32>(gpuData.vertices.size() * sizeof(Vertex))
-				};
-				SDL_UploadToGPUBuffer(
-					copyPass,
-					&vertexLocation,
-					&vertexRegion,
-					gpuData.cycle
-				);
-				SDL_GPUTransferBufferLocation indexLocation{
-					.transfer_buffer = gpuData.indexTransferBuffer,
-					.offset = 0
-				};
-				SDL_GPUBufferRegion indexRegion{
-					.buffer = gpuData.indexBuffer,
-					.offset = 0,
-					.size = static_cast<Uint32>(gpuData.indices.size() * sizeof(uint32_t))
-				};
-				SDL_UploadToGPUBuffer(copyPass,
-					&indexLocation,
-					&indexRegion,
-					gpuData.cycle
-				);
+			for (const auto& [impostor, variant] : builder.impostors_) {
+				impostorBatches_[variant].add(impostor);
 			}
-			SDL_EndGPUCopyPass(copyPass);
-		}
-
-		void uploadProjectionMatrix(SDL_GPUCommandBuffer* commandBuffer, const glm::mat4& projection, const glm::mat4& viewMatrix) {
-			projectionMatrix_ = projection;
-			viewMatrix_ = viewMatrix;
-			shader_.uploadProjectionMatrix(commandBuffer, projection * viewMatrix);
-		}
-
-		void uploadLightingData(SDL_GPUCommandBuffer* commandBuffer, const LightingData& lightingData) {
-			shader_.uploadLightingData(commandBuffer, lightingData);
 		}
 
-	private:
-		void addVertex(const glm::vec3& position, const glm::vec2& tex, sdl::Color color, const glm::vec3& normal = {}, DrawMode drawMode = DrawMode::Light) {
-			trianglesBuffer_.batch().pushBack(
-				Vertex{
-					getMatrix() * glm::vec4{position, 1},
-					DrawMode::NoLight == drawMode ? glm::vec2{-2.f, -2.f} : tex,
-					color,
-					glm::vec3{getMatrix() * glm::vec4{normal, 0.f}}
-				}
-			);
-		}
+		using Pipelines = std::array<sdl::GpuGraphicsPipeline, ShaderVariant::Count>;	// Index is the variant.
 
 		Shader shader_;
-		sdl::GpuGraphicsPipeline trianglesPipeline_;
-		sdl::GpuGraphicsPipeline linesPipeline_;
-		std::stack<glm::mat4> matrices_;
-		glm::mat4 projectionMatrix_;
-		glm::mat4 viewMatrix_;
-
-		TrianglesBuffer trianglesBuffer_;
+		SDL_GPUSampleCount gpuSampleCount_ = SDL_GPU_SAMPLECOUNT_1;
+		Pipelines trianglesPipelines_;
+		Pipelines transparentTrianglesPipelines_;
+		Pipelines instancedPipelines_;
+		Pipelines transparentInstancedPipelines_;
+		Pipelines linesPipelines_;
+		Pipelines impostorPipelines_;
+		sdl::GpuGraphicsPipeline lineBatchPipeline_;
+		sdl::GpuGraphicsPipeline floorPipeline_;
+		std::optional<Floor> floor_;	// Drawn in this frame.
+
+		FrameCamera camera_;
+		MeshCache meshCache_;
+		size_t culledInstances_ = 0;
+
+		std::vector<GeometryBuilder*> builders_{this};	// Submitted in the frame, this first.
+		std::vector<glm::mat4> frameTransforms_;	// Of all builders.
+		sdl::Buffer transformsBuffer_;
+		SDL_GPUBuffer* transformsGpuBuffer_ = nullptr;
 		std::vector<GpuData> gpuDatas_;
+		std::vector<StaticDraw> frameStaticDraws_;
+		FrameArena frameArena_;	// Transient data of the frame, reset by clear.
+		UploadRing uploadRing_;
+		LineBatch lineBatch_;
+		std::array<ImpostorBatch, ShaderVariant::Count> impostorBatches_;	// Index is the variant.
+		// Index is the variant, key is the Mesh or GpuMesh.
+		std::array<std::unordered_map<const void*, InstancedMesh>, ShaderVariant::Count> instancedMeshes_;
+
+		struct OpaqueMesh {
+			uint32_t variant;
+			float distance;	// To the nearest instance.
+			InstancedMesh* mesh;
+		};
+		std::vector<OpaqueMesh> opaqueMeshes_;
+
+		struct TransparentInstance {
+			float distance;
+			uint32_t variant;
+			InstancedMesh* mesh;
+			uint32_t index;	// In the transparent instances of the mesh, or in transparentShapeDraws_.
+		};
+		std::vector<TransparentInstance> transparentOrder_;
+
+		struct ShapeDraw {
+			uint32_t variant;
+			glm::vec3 center;	// World space.
+			TriangleRange triangles;
+		};
+		std::vector<ShapeDraw> transparentShapeDraws_;	// Of the builders and the static geometry.
+
+		// The mesh is nullptr for a shape, first is then its index in transparentShapeDraws_.
+		struct TransparentRun {
+			uint32_t variant;
+			InstancedMesh* mesh;
+			Uint32 first;
+			Uint32 count;
+		};
+		std::vector<TransparentRun> transparentRuns_;
+		std::vector<InstanceData> transparentInstances_;	// Back to front.
+		sdl::Buffer transparentInstanceBuffer_;
+		SDL_GPUBuffer* transparentInstanceGpuBuffer_ = nullptr;
+
+		glm::vec3 cameraPos_{0.f};
+		glm::vec3 ambient_{0.f};	// Of all lights.
+		std::vector<GpuLight> lights_;
+		std::vector<LightSphere> lightSpheres_;
+		LightClusters lightClusters_;
+		sdl::Buffer lightsBuffer_;
+		sdl::Buffer clustersBuffer_;
+		sdl::Buffer lightIndicesBuffer_;
+		SDL_GPUBuffer* lightsGpuBuffer_ = nullptr;
+		SDL_GPUBuffer* clustersGpuBuffer_ = nullptr;
+		SDL_GPUBuffer* lightIndicesGpuBuffer_ = nullptr;
 
 		sdl::GpuSampler sampler_;
 		sdl::GpuTexture texture_;
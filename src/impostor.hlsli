@@ -0,0 +1,10 @@
+// Shared by impostor.vs.hlsl and impostor.ps.hlsl. A sphere is a capsule with p1 == p2.
+struct ImpostorVSOutput
+{
+    float4 position : SV_Position;
+    float3 worldPos : TEXCOORD0; // On the bounding box, the ray goes from the camera through it.
+    nointerpolation float3 p1    : TEXCOORD1;
+    nointerpolation float3 p2    : TEXCOORD2;
+    nointerpolation float radius : TEXCOORD3;
+    nointerpolation float4 color : COLOR0;
+};
@@ -0,0 +1,93 @@
+#include "lighting.hlsli"
+#include "impostor.hlsli"
+
+cbuffer ImpostorData : register(b1, space3)
+{
+    float4x4 viewProjection;
+};
+
+struct PSOutput
+{
+    float4 color : SV_Target;
+    float depth  : SV_Depth;
+};
+
+static const float NoHit = 1e30;
+
+// Distance along the unit direction to the sphere, NoHit if missed or behind.
+float intersectSphere(float3 origin, float3 direction, float3 center, float radius)
+{
+    float3 oc = origin - center;
+    float b = dot(oc, direction);
+    float h = b * b - dot(oc, oc) + radius * radius;
+    if (h < 0.0)
+    {
+        return NoHit;
+    }
+    float t = -b - sqrt(h);
+    return t > 0.0 ? t : NoHit;
+}
+
+// The nearest of the cylinder between the end points and the spheres at the ends.
+float intersectCapsule(float3 origin, float3 direction, float3 p1, float3 p2, float radius)
+{
+    float t = min(intersectSphere(origin, direction, p1, radius), intersectSphere(origin, direction, p2, radius));
+
+    float3 ba = p2 - p1;
+    float3 oa = origin - p1;
+    float baba = dot(ba, ba);
+    float bard = dot(ba, direction);
+    float baoa = dot(ba, oa);
+    float a = baba - bard * bard; // Zero if the ray is parallel to the axis, the caps are hit.
+    if (a > 1e-8 * baba)
+    {
+        float b = baba * dot(direction, oa) - baoa * bard;
+        float c = baba * dot(oa, oa) - baoa * baoa - radius * radius * baba;
+        float h = b * b - a * c;
+        if (h >= 0.0)
+        {
+            float body = (-b - sqrt(h)) / a;
+            float y = baoa + body * bard;
+            if (body > 0.0 && y > 0.0 && y < baba)
+            {
+                t = min(t, body);
+            }
+        }
+    }
+    return t;
+}
+
+// Compiled lit and unlit (ROBOT_SHADER_UNLIT), as the triangle pixel shader.
+PSOutput main(ImpostorVSOutput input)
+{
+    float3 origin = cameraPos.xyz;
+    float3 direction = normalize(input.worldPos - origin);
+    float t = intersectCapsule(origin, direction, input.p1, input.p2, input.radius);
+    if (t == NoHit)
+    {
+        discard;
+    }
+    float3 worldPos = origin + t * direction;
+
+    float4 clip = mul(viewProjection, float4(worldPos, 1.0));
+    float depth = clip.z / clip.w;
+    if (depth < 0.0)
+    {
+        discard; // Clipped by the near plane like the other geometry.
+    }
+
+    PSOutput output;
+#ifdef ROBOT_SHADER_UNLIT
+    output.color = input.color;
+#else
+    // From the closest point on the axis.
+    float3 ba = input.p2 - input.p1;
+    float baba = dot(ba, ba);
+    float k = baba > 0.0 ? saturate(dot(worldPos - input.p1, ba) / baba) : 0.0;
+    float3 normal = (worldPos - (input.p1 + k * ba)) / input.radius;
+    float3 lighting = accumulateLighting(input.position.xy, worldPos, normal);
+    output.color = float4(input.color.rgb * lighting, input.color.a);
+#endif
+    output.depth = depth;
+    return output;
+}
@@ -0,0 +1,56 @@
+#include "impostor.hlsli"
+
+cbuffer VertexUniforms : register(b0, space1)
+{
+    float4x4 projectionMatrix;
+};
+
+struct VSInput
+{
+    // Per instance, there is no per vertex data.
+    float3 p1     : TEXCOORD0;
+    float radius  : TEXCOORD1;
+    float3 p2     : TEXCOORD2;
+    float4 color  : TEXCOORD3;
+    uint vertexId : SV_VertexID;
+};
+
+// Corner i of the box is at (x, y, z) = bits (0, 1, 2) of i, two counter-clockwise
+// triangles per face seen from the outside.
+static const uint boxIndices[36] = {
+    0, 4, 6, 0, 6, 2, // -x
+    1, 3, 7, 1, 7, 5, // +x
+    0, 1, 5, 0, 5, 4, // -y
+    2, 6, 7, 2, 7, 3, // +y
+    0, 2, 3, 0, 3, 1, // -z
+    4, 5, 7, 4, 7, 6  // +z
+};
+
+// The box around the capsule, aligned with its axis.
+ImpostorVSOutput main(VSInput input)
+{
+    uint corner = boxIndices[input.vertexId % 36];
+    float3 signs = float3(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1) * 2.0 - 1.0;
+
+    float3 axis = input.p2 - input.p1;
+    float halfLength = 0.5 * length(axis);
+    float3 ez = halfLength > 1e-6 ? axis / (2.0 * halfLength) : float3(0.0, 0.0, 1.0);
+    float3 up = abs(ez.z) < 0.999 ? float3(0.0, 0.0, 1.0) : float3(1.0, 0.0, 0.0);
+    float3 ex = normalize(cross(up, ez));
+    float3 ey = cross(ez, ex);
+
+    float3 center = 0.5 * (input.p1 + input.p2);
+    float3 worldPos = center
+        + ex * (signs.x * input.radius)
+        + ey * (signs.y * input.radius)
+        + ez * (signs.z * (halfLength + input.radius));
+
+    ImpostorVSOutput output;
+    output.position = mul(projectionMatrix, float4(worldPos, 1.0));
+    output.worldPos = worldPos;
+    output.p1 = input.p1;
+    output.p2 = input.p2;
+    output.radius = input.radius;
+    output.color = input.color;
+    return output;
+}
@@ -0,0 +1,38 @@
+#include "vertex.hlsli"
+
+cbuffer VertexUniforms : register(b0, space1)
+{
+    float4x4 projectionMatrix;
+};
+
+struct VSInput
+{
+    // Per vertex, unit mesh from the mesh cache.
+    float3 position : TEXCOORD0;
+    float3 normal   : TEXCOORD1;
+
+    // Per instance.
+    float4 model0   : TEXCOORD2; // Model matrix columns
+    float4 model1   : TEXCOORD3;
+    float4 model2   : TEXCOORD4;
+    float4 model3   : TEXCOORD5;
+    float4 color    : TEXCOORD6;
+    float2 radius   : TEXCOORD7; // x/y scale at z = 0 and z = 1, tapers cylinders
+};
+
+VSOutput main(VSInput input)
+{
+    float3 position = input.position;
+    position.xy *= lerp(input.radius.x, input.radius.y, position.z);
+
+    float4 worldPos = input.model0 * position.x + input.model1 * position.y + input.model2 * position.z + input.model3;
+    float3 normal = (input.model0 * input.normal.x + input.model1 * input.normal.y + input.model2 * input.normal.z).xyz;
+
+    VSOutput output;
+    output.position = mul(projectionMatrix, worldPos);
+    output.tex = float2(0.0, 0.0);
+    output.color = input.color;
+    output.worldPos = worldPos.xyz;
+    output.normal = normal;
+    return output;
+}
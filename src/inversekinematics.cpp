@@ -0,0 +1,189 @@
+#include "inversekinematics.h"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace robot {
+
+	namespace {
+
+		constexpr float Pi = glm::pi<float>();
+		constexpr float Epsilon = 1e-5f;
+
+		bool isZero(float value) {
+			return std::abs(value) < Epsilon;
+		}
+
+		// Returns the sign of sin(alpha) if alpha is +-Pi/2, otherwise 0.
+		float quarterTurnSign(float alpha) {
+			if (isZero(std::cos(alpha))) {
+				return std::sin(alpha) > 0 ? 1.f : -1.f;
+			}
+			return 0;
+		}
+
+		glm::mat3 rotation(const glm::mat4& h) {
+			return glm::mat3{glm::vec3{h[0]}, glm::vec3{h[1]}, glm::vec3{h[2]}};
+		}
+
+		// Unwraps each angle to the equivalent angle closest to previous and returns the squared joint motion.
+		float unwrap(std::array<float, 6>& angles, const std::array<float, 6>& previous) {
+			float motion = 0;
+			for (int i = 0; i < 6; ++i) {
+				angles[i] = previous[i] + std::remainder(angles[i] - previous[i], 2 * Pi);
+				const float delta = angles[i] - previous[i];
+				motion += delta * delta;
+			}
+			return motion;
+		}
+
+	}
+
+	InverseKinematics::InverseKinematics()
+		: InverseKinematics{createDefaultDH()} {
+	}
+
+	InverseKinematics::InverseKinematics(const RobotDHPar& dh)
+		: kinematics_{dh} {
+
+		const bool noShoulderOffset = isZero(dh.d[1]) && isZero(dh.d[2]) && isZero(dh.a[2]) && isZero(dh.alpha[1]);
+		const bool sphericalWrist = isZero(dh.a[3]) && isZero(dh.a[4]) && isZero(dh.a[5]) && isZero(dh.d[4]);
+		const bool quarterTurns = quarterTurnSign(dh.alpha[0]) != 0 && quarterTurnSign(dh.alpha[2]) != 0
+			&& quarterTurnSign(dh.alpha[3]) != 0 && quarterTurnSign(dh.alpha[4]) != 0;
+		if (!noShoulderOffset || !sphericalWrist || !quarterTurns || isZero(dh.a[1]) || isZero(dh.d[3])) {
+			throw std::invalid_argument{"[InverseKinematics] DH-parameters must describe an arm with a spherical wrist"};
+		}
+	}
+
+	IkSolutions InverseKinematics::solve(const glm::mat4& tcp) const {
+		const auto& dh = kinematics_.getDH();
+		const float sa1 = quarterTurnSign(dh.alpha[0]);
+		const float sa3 = quarterTurnSign(dh.alpha[2]);
+		const float sa4 = quarterTurnSign(dh.alpha[3]);
+		const float sa5 = quarterTurnSign(dh.alpha[4]);
+		const float a1 = dh.a[0];
+		const float a2 = dh.a[1];
+		const float d1 = dh.d[0];
+		const float d4 = dh.d[3] * sa3; // Signed distance along z3 from the elbow to the wrist center.
+
+		// The last rotation about x6 is constant, remove it to get the orientation of frame 5.
+		const glm::mat3 r = rotation(tcp);
+		const glm::mat3 rx6Inverse{
+			1, 0, 0,
+			0, std::cos(dh.alpha[5]), -std::sin(dh.alpha[5]),
+			0, std::sin(dh.alpha[5]), std::cos(dh.alpha[5])
+		};
+		const glm::mat3 r5 = r * rx6Inverse;
+		const glm::vec3 wristCenter = glm::vec3{tcp[3]} - dh.d[5] * r5[2];
+
+		IkSolutions solutions;
+		const float radius = std::hypot(wristCenter.x, wristCenter.y);
+		const float baseAngle = std::atan2(wristCenter.y, wristCenter.x);
+		for (int shoulder = 0; shoulder < 2; ++shoulder) {
+			std::array<float, 6> thetas;
+			thetas[0] = shoulder == 0 ? baseAngle : baseAngle + Pi;
+
+			// Wrist center in the plane of link 2 and 3, expressed along x1 and y1.
+			const float u = (shoulder == 0 ? radius : -radius) - a1;
+			const float v = sa1 * (wristCenter.z - d1);
+
+			const float s3 = (u * u + v * v - a2 * a2 - d4 * d4) / (2 * a2 * d4);
+			if (std::abs(s3) > 1 + Epsilon) {
+				continue; // Out of reach.
+			}
+			const float elbowAngle = std::asin(std::clamp(s3, -1.f, 1.f));
+
+			for (int elbow = 0; elbow < 2; ++elbow) {
+				thetas[2] = elbow == 0 ? elbowAngle : Pi - elbowAngle;
+				const float a = a2 + d4 * std::sin(thetas[2]);
+				const float b = d4 * std::cos(thetas[2]);
+				thetas[1] = std::atan2(a * v + b * u, a * u - b * v);
+
+				const glm::mat4 h3 = kinematics_.getH(thetas[0], 0) * kinematics_.getH(thetas[1], 1) * kinematics_.getH(thetas[2], 2);
+				// Orientation of frame 5 relative to frame 3, i.e. Rz(t4) * Rx(a4) * Rz(t5) * Rx(a5) * Rz(t6).
+				const glm::mat3 q = glm::transpose(rotation(h3)) * r5;
+
+				// Column 3 is sa5 * (c4 * s5, s4 * s5, -sa4 * c5) and row 3 is sa4 * s5 * (c6, -s6, *).
+				const float sin5 = std::hypot(q[2][0], q[2][1]);
+				const float cos5 = -sa4 * sa5 * q[2][2];
+				if (sin5 < Epsilon) {
+					// Wrist singularity, only the sum or difference of joint 4 and 6 is defined.
+					thetas[3] = 0;
+					thetas[4] = std::atan2(0.f, cos5);
+					thetas[5] = std::atan2(-sa4 * sa5 * q[0][1], cos5 * q[0][0]);
+					solutions.angles[solutions.size++] = convertThetas(thetas);
+					continue;
+				}
+				for (int wrist = 0; wrist < 2; ++wrist) {
+					const float sign = wrist == 0 ? 1.f : -1.f;
+					thetas[3] = std::atan2(sign * sa5 * q[2][1], sign * sa5 * q[2][0]);
+					thetas[4] = std::atan2(sign * sin5, cos5);
+					thetas[5] = std::atan2(-sign * sa4 * q[1][2], sign * sa4 * q[0][2]);
+					solutions.angles[solutions.size++] = convertThetas(thetas);
+				}
+			}
+		}
+		return solutions;
+	}
+
+	std::optional<std::array<float, 6>> InverseKinematics::solveClosest(const glm::mat4& tcp, const std::array<float, 6>& previous) const {
+		return selectClosest(solve(tcp), previous);
+	}
+
+	std::optional<std::array<float, 6>> InverseKinematics::selectClosest(const IkSolutions& solutions, const std::array<float, 6>& previous) {
+		std::optional<std::array<float, 6>> closest;
+		float smallestMotion = 0;
+		for (auto angles : solutions) {
+			const float motion = unwrap(angles, previous);
+			if (!closest || motion < smallestMotion) {
+				closest = angles;
+				smallestMotion = motion;
+			}
+		}
+		return closest;
+	}
+
+	size_t InverseKinematics::solveTrajectory(std::span<const glm::mat4> poses, const std::array<float, 6>& start,
+		std::span<std::array<float, 6>> solutions, unsigned int threads) const {
+
+		const size_t size = std::min(poses.size(), solutions.size());
+		if (threads == 0) {
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		// The branches of each pose are independent of the other poses.
+		std::vector<IkSolutions> branches(size);
+		const size_t chunk = (size + threads - 1) / threads;
+		{
+			std::vector<std::jthread> workers;
+			for (size_t begin = 0; begin < size; begin += chunk) {
+				const size_t end = std::min(size, begin + chunk);
+				workers.emplace_back([&, begin, end]() {
+					for (size_t i = begin; i < end; ++i) {
+						branches[i] = solve(poses[i]);
+					}
+				});
+			}
+		}
+
+		// The branch selection depends on the previous pose and is cheap, done in order.
+		const std::array<float, 6>* previous = &start;
+		for (size_t i = 0; i < size; ++i) {
+			auto closest = selectClosest(branches[i], *previous);
+			if (!closest) {
+				return i;
+			}
+			solutions[i] = *closest;
+			previous = &solutions[i];
+		}
+		return size;
+	}
+
+}
@@ -0,0 +1,75 @@
+#ifndef ROBOT_INVERSEKINEMATICS_H
+#define ROBOT_INVERSEKINEMATICS_H
+
+#include "robotkinematics.h"
+
+#include <glm/mat4x4.hpp>
+
+#include <array>
+#include <optional>
+#include <span>
+
+namespace robot {
+
+	/// All joint configurations reaching one TCP-frame, same angle convention as convertAngles.
+	struct IkSolutions {
+		static constexpr int MaxSize = 8;
+
+		std::array<std::array<float, 6>, MaxSize> angles;
+		int size = 0;
+
+		auto begin() const {
+			return angles.begin();
+		}
+
+		auto end() const {
+			return angles.begin() + size;
+		}
+
+		bool empty() const {
+			return size == 0;
+		}
+	};
+
+	/// Analytic inverse kinematics for a 6 degree of freedom robot with a spherical wrist,
+	/// e.g. the ABB IRB-140. Decouples the problem into the wrist center position, given by
+	/// the first three joints, and the wrist orientation, given by the last three joints.
+	class InverseKinematics {
+	public:
+		/// Uses the default DH-parameters.
+		InverseKinematics();
+
+		/// Throws std::invalid_argument if the DH-parameters do not describe an arm
+		/// without shoulder offset and with a spherical wrist.
+		explicit InverseKinematics(const RobotDHPar& dh);
+
+		/// Returns all solutions, up to 8 (shoulder front/back, elbow up/down, wrist flip).
+		/// At a wrist singularity only one solution per arm configuration is returned,
+		/// with the angle of joint 4 kept at zero.
+		IkSolutions solve(const glm::mat4& tcp) const;
+
+		/// Returns the solution with the smallest joint motion from previous, or nothing if
+		/// the TCP-frame is not reachable. Angles are unwrapped to be closest to previous.
+		std::optional<std::array<float, 6>> solveClosest(const glm::mat4& tcp, const std::array<float, 6>& previous) const;
+
+		/// Solves a trajectory of TCP-frames, the branches are solved in parallel on the given
+		/// number of threads (0 uses all hardware threads) and each pose then selects the solution
+		/// closest to the one before, starting from start. Returns the number of solved poses,
+		/// which is less than poses.size() if a pose is not reachable.
+		size_t solveTrajectory(std::span<const glm::mat4> poses, const std::array<float, 6>& start,
+			std::span<std::array<float, 6>> solutions, unsigned int threads = 0) const;
+
+		/// Returns the solution in solutions with the smallest joint motion from previous.
+		static std::optional<std::array<float, 6>> selectClosest(const IkSolutions& solutions, const std::array<float, 6>& previous);
+
+		const RobotKinematics& getKinematics() const {
+			return kinematics_;
+		}
+
+	private:
+		RobotKinematics kinematics_;
+	};
+
+}
+
+#endif
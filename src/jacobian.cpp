@@ -0,0 +1,97 @@
+#include "jacobian.h"
+
+#include <glm/geometric.hpp>
+
+#include <cmath>
+
+namespace robot {
+
+	Matrix6 computeJacobian(const std::array<glm::mat4, 7>& frames) {
+		const glm::vec3 tcp{frames[6][3]};
+
+		// Jacobian for the DH-angles, joint n rotates around z of frame n.
+		Matrix6 dh{};
+		for (int n = 0; n < 6; ++n) {
+			const glm::vec3 z{frames[n][2]};
+			const glm::vec3 linear = glm::cross(z, tcp - glm::vec3{frames[n][3]});
+			for (int row = 0; row < 3; ++row) {
+				dh[row][n] = linear[row];
+				dh[row + 3][n] = z[row];
+			}
+		}
+
+		// Chain rule with the derivative of convertAngles.
+		Matrix6 jacobian;
+		for (int row = 0; row < 6; ++row) {
+			jacobian[row] = {
+				dh[row][0],
+				dh[row][1] - dh[row][2],
+				dh[row][2],
+				dh[row][3],
+				-dh[row][4],
+				dh[row][5]
+			};
+		}
+		return jacobian;
+	}
+
+	Vector6 solveDampedLeastSquares(const Matrix6& jacobian, const Vector6& twist, float damping) {
+		// A = J * J^T + damping^2 * I, symmetric positive definite.
+		Matrix6 a;
+		for (int row = 0; row < 6; ++row) {
+			for (int column = 0; column <= row; ++column) {
+				float sum = 0;
+				for (int k = 0; k < 6; ++k) {
+					sum += jacobian[row][k] * jacobian[column][k];
+				}
+				a[row][column] = sum;
+				a[column][row] = sum;
+			}
+			a[row][row] += damping * damping;
+		}
+
+		// Cholesky decomposition A = L * L^T, L stored in the lower triangle of a.
+		for (int column = 0; column < 6; ++column) {
+			float diagonal = a[column][column];
+			for (int k = 0; k < column; ++k) {
+				diagonal -= a[column][k] * a[column][k];
+			}
+			diagonal = std::sqrt(diagonal);
+			a[column][column] = diagonal;
+			for (int row = column + 1; row < 6; ++row) {
+				float sum = a[row][column];
+				for (int k = 0; k < column; ++k) {
+					sum -= a[row][k] * a[column][k];
+				}
+				a[row][column] = sum / diagonal;
+			}
+		}
+
+		// Solve L * y = twist and L^T * x = y.
+		Vector6 x;
+		for (int row = 0; row < 6; ++row) {
+			float sum = twist[row];
+			for (int k = 0; k < row; ++k) {
+				sum -= a[row][k] * x[k];
+			}
+			x[row] = sum / a[row][row];
+		}
+		for (int row = 5; row >= 0; --row) {
+			float sum = x[row];
+			for (int k = row + 1; k < 6; ++k) {
+				sum -= a[k][row] * x[k];
+			}
+			x[row] = sum / a[row][row];
+		}
+
+		// dq = J^T * x
+		Vector6 velocities{};
+		for (int joint = 0; joint < 6; ++joint) {
+			for (int row = 0; row < 6; ++row) {
+				velocities[joint] += jacobian[row][joint] * x[row];
+			}
+		}
+		return velocities;
+	}
+
+}
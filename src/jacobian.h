@@ -0,0 +1,26 @@
+#ifndef ROBOT_JACOBIAN_H
+#define ROBOT_JACOBIAN_H
+
+#include <glm/mat4x4.hpp>
+
+#include <array>
+
+namespace robot {
+
+	using Vector6 = std::array<float, 6>;
+
+	/// Row-major 6x6 matrix, i.e. matrix[row][column].
+	using Matrix6 = std::array<Vector6, 6>;
+
+	/// Returns the geometric Jacobian for the joint frames (index 0 is the base frame and 6 the TCP-frame),
+	/// e.g. from KinematicsCache::getFrames. Rows 0-2 are the linear velocity of the TCP and rows 3-5 the
+	/// angular velocity, both in the base frame. Columns are in the joint angle convention of convertAngles.
+	Matrix6 computeJacobian(const std::array<glm::mat4, 7>& frames);
+
+	/// Returns the joint velocities for the twist (linear, angular) using damped least squares,
+	/// dq = J^T * (J * J^T + damping^2 * I)^-1 * twist. Stays bounded close to singularities.
+	Vector6 solveDampedLeastSquares(const Matrix6& jacobian, const Vector6& twist, float damping);
+
+}
+
+#endif
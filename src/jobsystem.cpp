@@ -0,0 +1,100 @@
+#include "jobsystem.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace robot {
+
+	size_t JobSystem::getDefaultWorkerCount() {
+		return std::max(1u, std::thread::hardware_concurrency()) - 1;
+	}
+
+	JobSystem::JobSystem(size_t workerCount) {
+		workers_.reserve(workerCount);
+		for (size_t i = 0; i < workerCount; ++i) {
+			workers_.emplace_back([this](std::stop_token stopToken) {
+				workerLoop(stopToken);
+			});
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		for (auto& worker : workers_) {
+			worker.request_stop();
+		}
+		wake_.notify_all();
+		workers_.clear();
+	}
+
+	void JobSystem::run(size_t count, void (*invoke)(void*, size_t), void* job) {
+		if (count == 0) {
+			return;
+		}
+		{
+			std::unique_lock lock{mutex_};
+			// A worker woken late for the last call may still be looking for work.
+			done_.wait(lock, [&] {
+				return active_ == 0;
+			});
+			invoke_ = invoke;
+			job_ = job;
+			count_ = count;
+			remaining_ = count;
+			next_ = 0;
+			++generation_;
+		}
+		if (count > 1) {
+			wake_.notify_all();
+		}
+
+		work();
+
+		std::unique_lock lock{mutex_};
+		done_.wait(lock, [&] {
+			return remaining_ == 0 && active_ == 0;
+		});
+		if (exception_) {
+			std::rethrow_exception(std::exchange(exception_, nullptr));
+		}
+	}
+
+	void JobSystem::work() {
+		for (size_t index = next_++; index < count_; index = next_++) {
+			try {
+				invoke_(job_, index);
+			} catch (...) {
+				std::lock_guard lock{mutex_};
+				if (!exception_) {
+					exception_ = std::current_exception();
+				}
+			}
+			if (--remaining_ == 0) {
+				std::lock_guard lock{mutex_};
+				done_.notify_all();
+			}
+		}
+	}
+
+	void JobSystem::workerLoop(std::stop_token stopToken) {
+		uint64_t generation = 0;
+		while (true) {
+			{
+				std::unique_lock lock{mutex_};
+				if (!wake_.wait(lock, stopToken, [&] {
+					return generation_ != generation;
+				})) {
+					return;
+				}
+				generation = generation_;
+				++active_;
+			}
+
+			work();
+
+			std::lock_guard lock{mutex_};
+			--active_;
+			done_.notify_all();
+		}
+	}
+
+}
@@ -0,0 +1,70 @@
+#ifndef ROBOT_JOBSYSTEM_H
+#define ROBOT_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace robot {
+
+	/// Fixed pool of worker threads for fork-join jobs within a frame, e.g. building
+	/// independent parts of the scene. Does not allocate per call.
+	class JobSystem {
+	public:
+		/// One worker less than the hardware threads, the calling thread works as well.
+		static size_t getDefaultWorkerCount();
+
+		explicit JobSystem(size_t workerCount = getDefaultWorkerCount());
+
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		size_t getWorkerCount() const {
+			return workers_.size();
+		}
+
+		/// Calls job(i) for each i in [0, count) on the workers and the calling thread and
+		/// returns when all calls are done. The first exception thrown by a job is rethrown.
+		/// Only one thread at a time may call parallelFor.
+		template <typename Job>
+		void parallelFor(size_t count, Job&& job) {
+			run(count, [](void* data, size_t index) {
+				(*static_cast<std::remove_reference_t<Job>*>(data))(index);
+			}, &job);
+		}
+
+	private:
+		void run(size_t count, void (*invoke)(void*, size_t), void* job);
+
+		void work();
+
+		void workerLoop(std::stop_token stopToken);
+
+		std::mutex mutex_;
+		std::condition_variable_any wake_;
+		std::condition_variable done_;
+		uint64_t generation_ = 0;	// Incremented for each parallelFor.
+		size_t active_ = 0;	// Workers inside work().
+
+		void (*invoke_)(void*, size_t) = nullptr;
+		void* job_ = nullptr;
+		size_t count_ = 0;
+		std::atomic<size_t> next_ = 0;
+		std::atomic<size_t> remaining_ = 0;
+		std::exception_ptr exception_;
+
+		std::vector<std::jthread> workers_;
+	};
+
+}
+
+#endif
@@ -0,0 +1,131 @@
+#include "lightclusters.h"
+
+#include <glm/vec4.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace robot {
+
+	namespace {
+
+		// Tile of the normalized device coordinate in [-1, 1], clamped to the screen.
+		uint32_t toTile(float ndc, uint32_t tiles) {
+			const float tile = std::floor((ndc + 1.f) * 0.5f * static_cast<float>(tiles));
+			return static_cast<uint32_t>(std::clamp(tile, 0.f, static_cast<float>(tiles - 1)));
+		}
+
+		// Squared distance from the point to the box [min, max].
+		float distanceSquared(const glm::vec3& point, const glm::vec3& min, const glm::vec3& max) {
+			float sum = 0.f;
+			for (int i = 0; i < 3; ++i) {
+				const float d = std::max({min[i] - point[i], 0.f, point[i] - max[i]});
+				sum += d * d;
+			}
+			return sum;
+		}
+
+	}
+
+	void LightClusters::update(const glm::mat4& view, const glm::mat4& projection, std::span<const LightSphere> lights) {
+		near_ = projection[3][2] / (projection[2][2] - 1.f);
+		far_ = projection[3][2] / (projection[2][2] + 1.f);
+		tanHalfX_ = 1.f / projection[0][0];
+		tanHalfY_ = 1.f / projection[1][1];
+		sliceScale_ = static_cast<float>(Slices) / std::log(far_ / near_);
+		sliceBias_ = -std::log(near_) * sliceScale_;
+
+		assignments_.clear();
+		for (uint32_t i = 0; i < lights.size(); ++i) {
+			const glm::vec3 center{view * glm::vec4{lights[i].position, 1.f}};
+			assign(i, center, lights[i].radius);
+		}
+
+		// Counting sort of the assignments by cluster.
+		for (auto& cluster : clusters_) {
+			cluster = Cluster{0, 0};
+		}
+		for (const auto& assignment : assignments_) {
+			++clusters_[assignment.cluster].count;
+		}
+		uint32_t offset = 0;
+		maxCount_ = 0;
+		for (auto& cluster : clusters_) {
+			cluster.offset = offset;
+			offset += cluster.count;
+			maxCount_ = std::max(maxCount_, cluster.count);
+			cluster.count = 0;
+		}
+		lightIndices_.resize(assignments_.size());
+		for (const auto& assignment : assignments_) {
+			auto& cluster = clusters_[assignment.cluster];
+			lightIndices_[cluster.offset + cluster.count++] = assignment.light;
+		}
+	}
+
+	uint32_t LightClusters::getSlice(float depth) const {
+		const float slice = std::log(std::max(depth, 1e-5f)) * sliceScale_ + sliceBias_;
+		return static_cast<uint32_t>(std::clamp(slice, 0.f, static_cast<float>(Slices - 1)));
+	}
+
+	void LightClusters::assign(uint32_t light, const glm::vec3& center, float radius) {
+		// The view looks along -z, depth is the distance in front of the camera.
+		const float minDepth = std::max(-center.z - radius, near_);
+		const float maxDepth = -center.z + radius;
+		if (maxDepth < near_ || minDepth > far_) {
+			return;
+		}
+
+		// The screen rectangle of the box around the sphere, x / depth is extreme at the
+		// nearest or the farthest depth.
+		auto ndcRange = [&](float min, float max, float tanHalf, float& ndcMin, float& ndcMax) {
+			ndcMin = std::min(min / minDepth, min / maxDepth) / tanHalf;
+			ndcMax = std::max(max / minDepth, max / maxDepth) / tanHalf;
+		};
+		float xMin, xMax, yMin, yMax;
+		ndcRange(center.x - radius, center.x + radius, tanHalfX_, xMin, xMax);
+		ndcRange(center.y - radius, center.y + radius, tanHalfY_, yMin, yMax);
+		if (xMax < -1.f || xMin > 1.f || yMax < -1.f || yMin > 1.f) {
+			return;
+		}
+		const uint32_t tileX0 = toTile(xMin, TilesX);
+		const uint32_t tileX1 = toTile(xMax, TilesX);
+		// Tile y counts from the top.
+		const uint32_t tileY0 = TilesY - 1 - toTile(yMax, TilesY);
+		const uint32_t tileY1 = TilesY - 1 - toTile(yMin, TilesY);
+		const uint32_t slice0 = getSlice(minDepth);
+		const uint32_t slice1 = getSlice(maxDepth);
+
+		const float radiusSquared = radius * radius;
+		for (uint32_t slice = slice0; slice <= slice1; ++slice) {
+			const float depth0 = std::exp((static_cast<float>(slice) - sliceBias_) / sliceScale_);
+			const float depth1 = std::exp((static_cast<float>(slice + 1) - sliceBias_) / sliceScale_);
+			for (uint32_t tileY = tileY0; tileY <= tileY1; ++tileY) {
+				const float top = (1.f - 2.f * static_cast<float>(tileY) / TilesY) * tanHalfY_;
+				const float bottom = (1.f - 2.f * static_cast<float>(tileY + 1) / TilesY) * tanHalfY_;
+				for (uint32_t tileX = tileX0; tileX <= tileX1; ++tileX) {
+					const float left = (-1.f + 2.f * static_cast<float>(tileX) / TilesX) * tanHalfX_;
+					const float right = (-1.f + 2.f * static_cast<float>(tileX + 1) / TilesX) * tanHalfX_;
+					// The box around the cluster, the edges are the lines x = left * depth etc.
+					const glm::vec3 min{
+						std::min(left * depth0, left * depth1),
+						std::min(bottom * depth0, bottom * depth1),
+						-depth1
+					};
+					const glm::vec3 max{
+						std::max(right * depth0, right * depth1),
+						std::max(top * depth0, top * depth1),
+						-depth0
+					};
+					if (distanceSquared(center, min, max) <= radiusSquared) {
+						assignments_.push_back(Assignment{
+							.cluster = static_cast<uint32_t>(getIndex(tileX, tileY, slice)),
+							.light = light
+						});
+					}
+				}
+			}
+		}
+	}
+
+}
@@ -0,0 +1,96 @@
+#ifndef ROBOT_LIGHTCLUSTERS_H
+#define ROBOT_LIGHTCLUSTERS_H
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace robot {
+
+	/// The volume lit by a light, in world space.
+	struct LightSphere {
+		glm::vec3 position;
+		float radius;
+	};
+
+	/// Assigns lights to the clusters of the view frustum, TilesX x TilesY screen tiles times
+	/// Slices depth slices, spaced exponentially between the near and the far plane. A light
+	/// is only assigned to the clusters its sphere reaches, so a fragment only evaluates the
+	/// lights of its cluster. Allocates nothing once the number of assignments stops growing.
+	class LightClusters {
+	public:
+		static constexpr uint32_t TilesX = 16;
+		static constexpr uint32_t TilesY = 9;
+		static constexpr uint32_t Slices = 24;
+		static constexpr size_t Count = TilesX * TilesY * Slices;
+
+		/// The lights of a cluster are getLightIndices()[offset, offset + count), must match
+		/// the Clusters buffer in shader.ps.hlsl.
+		struct Cluster {
+			uint32_t offset;
+			uint32_t count;
+		};
+
+		/// Tile y = 0 is the top of the screen, as the pixel coordinates of the fragments.
+		static size_t getIndex(uint32_t tileX, uint32_t tileY, uint32_t slice) {
+			return (static_cast<size_t>(slice) * TilesY + tileY) * TilesX + tileX;
+		}
+
+		/// The projection is a symmetric perspective from glm::perspective with the clip depth
+		/// in [-1, 1], the near and far plane are taken from it.
+		void update(const glm::mat4& view, const glm::mat4& projection, std::span<const LightSphere> lights);
+
+		/// Slice of the distance along the view direction, computed as in the shader.
+		uint32_t getSlice(float depth) const;
+
+		/// log(depth) * scale + bias is the slice of the depth.
+		float getSliceScale() const {
+			return sliceScale_;
+		}
+
+		float getSliceBias() const {
+			return sliceBias_;
+		}
+
+		std::span<const Cluster> getClusters() const {
+			return clusters_;
+		}
+
+		std::span<const uint32_t> getLightIndices() const {
+			return lightIndices_;
+		}
+
+		/// Largest number of lights in one cluster in the last update.
+		uint32_t getMaxCount() const {
+			return maxCount_;
+		}
+
+	private:
+		struct Assignment {
+			uint32_t cluster;
+			uint32_t light;
+		};
+
+		// Adds the light to the clusters within the ranges its sphere intersects.
+		void assign(uint32_t light, const glm::vec3& center, float radius);
+
+		float near_ = 0.1f;
+		float far_ = 100.f;
+		float tanHalfX_ = 1.f;	// View x / depth at the right edge of the screen.
+		float tanHalfY_ = 1.f;	// View y / depth at the top edge of the screen.
+		float sliceScale_ = 0.f;
+		float sliceBias_ = 0.f;
+		uint32_t maxCount_ = 0;
+
+		std::vector<Cluster> clusters_ = std::vector<Cluster>(Count);
+		std::vector<Assignment> assignments_;
+		std::vector<uint32_t> lightIndices_;
+	};
+
+}
+
+#endif
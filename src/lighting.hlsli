@@ -0,0 +1,68 @@
+// Clustered forward lighting, shared by the pixel shaders. The resources follow the
+// sampled texture in space2, as SDL_GPU requires, see Shader::load.
+
+struct Light
+{
+    float4 position;   // xyz = world pos
+    float4 color;      // rgb = color
+    float4 params;     // x = radius, y = ambientStrength, z = shininess
+};
+
+cbuffer LightData : register(b0, space3)
+{
+    float4 cameraPos;
+    float4 ambient;        // rgb = ambient of all lights, independent of the distance
+    float4 viewDepth;      // dot(viewDepth, float4(worldPos, 1)) = distance along the view direction
+    float2 tileScale;      // Pixels to tiles
+    float2 sliceScaleBias; // log(distance) * x + y = depth slice
+    uint4  clusterSize;    // Tiles in x and y, depth slices
+};
+
+// After the sampled texture, as SDL_GPU requires. Filled by LightClusters on the CPU.
+StructuredBuffer<Light> Lights : register(t1, space2);
+StructuredBuffer<uint2> Clusters : register(t2, space2);     // x = offset in LightIndices, y = count
+StructuredBuffer<uint> LightIndices : register(t3, space2);
+
+// Same as LightClusters::getIndex and LightClusters::getSlice.
+uint getClusterIndex(float2 pixel, float3 worldPos)
+{
+    uint2 tile = min(uint2(pixel * tileScale), clusterSize.xy - 1);
+    float depth = max(dot(viewDepth, float4(worldPos, 1.0)), 1e-5);
+    float slice = clamp(log(depth) * sliceScaleBias.x + sliceScaleBias.y, 0.0, clusterSize.z - 1.0);
+    return ((uint) slice * clusterSize.y + tile.y) * clusterSize.x + tile.x;
+}
+
+// The pixel is SV_Position.xy of the fragment.
+float3 accumulateLighting(float2 pixel, float3 worldPos, float3 normal)
+{
+    float3 totalLight = ambient.rgb;
+
+    float3 N = normalize(normal);
+    float3 V = normalize(cameraPos.xyz - worldPos);
+
+    // Only the lights reaching the cluster of the fragment.
+    uint2 cluster = Clusters[getClusterIndex(pixel, worldPos)];
+    for (uint i = 0; i < cluster.y; i++)
+    {
+        Light Lgt = Lights[LightIndices[cluster.x + i]];
+
+        float radius    = Lgt.params.x;
+        float shininess = Lgt.params.z;
+
+        float3 toLight = Lgt.position.xyz - worldPos;
+        float dist = length(toLight);
+        float attenuation = saturate(1.0 - dist / radius);
+
+        float3 L = normalize(toLight);
+        float3 H = normalize(L + V);
+
+        float NdotL = max(dot(N, L), 0.0);
+
+        float3 diffuse  = Lgt.color.rgb * NdotL * attenuation;
+        float3 specular = Lgt.color.rgb * pow(max(dot(N, H), 0.0), shininess) * attenuation;
+
+        totalLight += diffuse + specular;
+    }
+
+    return totalLight;
+}
@@ -0,0 +1,70 @@
+#include "vertex.hlsli"
+
+cbuffer VertexUniforms : register(b0, space1)
+{
+    float4x4 projectionMatrix;
+};
+
+cbuffer LineUniforms : register(b1, space1)
+{
+    float2 viewportSize; // Pixels
+};
+
+struct VSInput
+{
+    // Per instance, there is no per vertex data.
+    float3 p1     : TEXCOORD0;
+    float width   : TEXCOORD1; // Pixels
+    float3 p2     : TEXCOORD2;
+    float4 color  : TEXCOORD3;
+    uint vertexId : SV_VertexID;
+};
+
+// Two triangles, x selects the end of the line and y the side.
+static const float2 corners[6] = {
+    float2(0.0, -1.0), float2(1.0, -1.0), float2(1.0, 1.0),
+    float2(1.0, 1.0), float2(0.0, 1.0), float2(0.0, -1.0)
+};
+
+// Moves an end behind the camera along the line to w = minW, so that both ends can be
+// divided by w. The rasterizer clips the rest.
+float4 clipBehindCamera(float4 a, float4 b)
+{
+    const float minW = 1e-5;
+    if (a.w >= minW) {
+        return a;
+    }
+    return lerp(a, b, (minW - a.w) / (b.w - a.w));
+}
+
+VSOutput main(VSInput input)
+{
+    float2 corner = corners[input.vertexId % 6];
+
+    float4 clip1 = mul(projectionMatrix, float4(input.p1, 1.0));
+    float4 clip2 = mul(projectionMatrix, float4(input.p2, 1.0));
+
+    VSOutput output;
+    output.tex = float2(0.0, 0.0);
+    output.color = input.color;
+    output.worldPos = lerp(input.p1, input.p2, corner.x);
+    output.normal = float3(0.0, 0.0, 0.0);
+    if (max(clip1.w, clip2.w) < 1e-5) {
+        // Entirely behind the camera, degenerate triangles are not rasterized.
+        output.position = float4(0.0, 0.0, 0.0, 1.0);
+        return output;
+    }
+    float4 a = clipBehindCamera(clip1, clip2);
+    float4 b = clipBehindCamera(clip2, clip1);
+
+    // Direction on screen in pixels, a line along the view axis becomes a square.
+    float2 dir = (b.xy / b.w - a.xy / a.w) * viewportSize;
+    dir = dot(dir, dir) > 1e-12 ? normalize(dir) : float2(1.0, 0.0);
+    float2 normal = float2(-dir.y, dir.x);
+
+    // Half the width to each side, in NDC and multiplied by w to undo the division.
+    float4 position = lerp(a, b, corner.x);
+    position.xy += normal * corner.y * input.width / viewportSize * position.w;
+    output.position = position;
+    return output;
+}
@@ -0,0 +1,60 @@
+#ifndef ROBOT_MATRIXSTACK_H
+#define ROBOT_MATRIXSTACK_H
+
+#include <glm/mat4x4.hpp>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace robot {
+
+	/// Stack of matrices with a fixed capacity, never allocates. Always holds at least
+	/// one matrix, the identity after construction and reset.
+	class MatrixStack {
+	public:
+		static constexpr size_t Capacity = 32;
+
+		/// Pushes a copy of the top matrix.
+		void push() {
+			if (size_ == Capacity) {
+				throw std::length_error{"[MatrixStack] Capacity exceeded"};
+			}
+			matrices_[size_] = matrices_[size_ - 1];
+			++size_;
+		}
+
+		/// Returns false, and keeps the matrix, if only one matrix is left.
+		bool pop() {
+			if (size_ == 1) {
+				return false;
+			}
+			--size_;
+			return true;
+		}
+
+		void reset() {
+			size_ = 1;
+			matrices_[0] = glm::mat4{1.f};
+		}
+
+		glm::mat4& top() {
+			return matrices_[size_ - 1];
+		}
+
+		const glm::mat4& top() const {
+			return matrices_[size_ - 1];
+		}
+
+		size_t size() const {
+			return size_;
+		}
+
+	private:
+		std::array<glm::mat4, Capacity> matrices_{glm::mat4{1.f}};
+		size_t size_ = 1;
+	};
+
+}
+
+#endif
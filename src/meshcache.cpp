@@ -0,0 +1,194 @@
+#include "meshcache.h"
+
+#include <glm/geometric.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <utility>
+
+namespace robot {
+
+	namespace {
+
+		constexpr float Pi = glm::pi<float>();
+
+		// Slices for each level of detail, the sphere uses half as many stacks.
+		constexpr std::array<unsigned int, MeshCache::LodCount> LodSlices{6, 10, 16, 28, 48};
+
+		Mesh createCube() {
+			Mesh mesh;
+			const float h = 0.5f;
+			auto addFace = [&](const glm::vec3& normal, std::initializer_list<glm::vec3> corners) {
+				const auto offset = static_cast<uint32_t>(mesh.vertices.size());
+				for (const auto& corner : corners) {
+					mesh.vertices.push_back({corner, normal});
+				}
+				mesh.indices.insert(mesh.indices.end(), {
+					offset, offset + 1, offset + 2,
+					offset + 2, offset + 3, offset
+				});
+			};
+			addFace({0, 0, -1}, {{-h, -h, -h}, {h, -h, -h}, {h, h, -h}, {-h, h, -h}});	// Back face
+			addFace({0, 0, 1}, {{-h, -h, h}, {h, -h, h}, {h, h, h}, {-h, h, h}});		// Front face
+			addFace({-1, 0, 0}, {{-h, -h, -h}, {-h, -h, h}, {-h, h, h}, {-h, h, -h}});	// Left face
+			addFace({1, 0, 0}, {{h, -h, -h}, {h, -h, h}, {h, h, h}, {h, h, -h}});		// Right face
+			addFace({0, 1, 0}, {{-h, h, -h}, {h, h, -h}, {h, h, h}, {-h, h, h}});		// Top face
+			addFace({0, -1, 0}, {{-h, -h, -h}, {h, -h, -h}, {h, -h, h}, {-h, -h, h}});	// Bottom face
+			return mesh;
+		}
+
+		Mesh createSphere(unsigned int slices, unsigned int stacks) {
+			Mesh mesh;
+			auto addVertex = [&](const glm::vec3& position) {
+				mesh.vertices.push_back({position, glm::normalize(position)});
+			};
+
+			addVertex({0, 1, 0});
+			for (unsigned int stack = 1; stack < stacks; ++stack) {
+				float stackAngle = Pi / 2.0f - Pi * stack / stacks;
+				float xy = std::cos(stackAngle);
+				float y = std::sin(stackAngle);
+				for (unsigned int slice = 0; slice <= slices; ++slice) {
+					float sliceAngle = 2.0f * Pi * slice / slices;
+					addVertex({xy * std::cos(sliceAngle), y, xy * std::sin(sliceAngle)});
+				}
+			}
+			addVertex({0, -1, 0});
+
+			// Top cap
+			for (unsigned int slice = 0; slice < slices; ++slice) {
+				mesh.indices.insert(mesh.indices.end(), {0, slice + 1, slice + 2});
+			}
+
+			// Middle stacks
+			for (unsigned int stack = 0; stack + 2 < stacks; ++stack) {
+				unsigned int k1 = 1 + stack * (slices + 1);
+				unsigned int k2 = k1 + slices + 1;
+				for (unsigned int slice = 0; slice < slices; ++slice) {
+					mesh.indices.insert(mesh.indices.end(), {
+						k1 + slice, k2 + slice, k2 + slice + 1,
+						k2 + slice + 1, k1 + slice + 1, k1 + slice
+					});
+				}
+			}
+
+			// Bottom cap
+			unsigned int bottomVertex = 1 + (stacks - 1) * (slices + 1);
+			unsigned int lastStackStart = 1 + (stacks - 2) * (slices + 1);
+			for (unsigned int slice = 0; slice < slices; ++slice) {
+				mesh.indices.insert(mesh.indices.end(), {lastStackStart + slice, bottomVertex, lastStackStart + slice + 1});
+			}
+			return mesh;
+		}
+
+		Mesh createCylinder(unsigned int slices, unsigned int stacks) {
+			Mesh mesh;
+			std::vector<glm::vec3> circle;
+			for (unsigned int slice = 0; slice <= slices; ++slice) {
+				float angle = 2.0f * Pi * slice / slices;
+				circle.emplace_back(std::cos(angle), std::sin(angle), 0.f);
+			}
+
+			// Side faces, the normal is in the radial direction.
+			for (unsigned int stack = 0; stack <= stacks; ++stack) {
+				float z = static_cast<float>(stack) / stacks;
+				for (const auto& direction : circle) {
+					mesh.vertices.push_back({{direction.x, direction.y, z}, direction});
+				}
+			}
+			for (unsigned int stack = 0; stack < stacks; ++stack) {
+				for (unsigned int slice = 0; slice < slices; ++slice) {
+					unsigned int current = stack * (slices + 1) + slice;
+					unsigned int next = current + slices + 1;
+					mesh.indices.insert(mesh.indices.end(), {
+						current, next, next + 1,
+						next + 1, current + 1, current
+					});
+				}
+			}
+
+			// Caps, the top cap has reversed winding order.
+			for (float z : {0.f, 1.f}) {
+				const auto center = static_cast<uint32_t>(mesh.vertices.size());
+				const glm::vec3 normal{0, 0, z == 0 ? -1.f : 1.f};
+				mesh.vertices.push_back({{0, 0, z}, normal});
+				for (const auto& direction : circle) {
+					mesh.vertices.push_back({{direction.x, direction.y, z}, normal});
+				}
+				for (unsigned int slice = 0; slice < slices; ++slice) {
+					if (z == 0) {
+						mesh.indices.insert(mesh.indices.end(), {center, center + slice + 1, center + slice + 2});
+					} else {
+						mesh.indices.insert(mesh.indices.end(), {center, center + slice + 2, center + slice + 1});
+					}
+				}
+			}
+			return mesh;
+		}
+
+	}
+
+	int MeshCache::getLodLevel(float screenRadius, float maxError) {
+		for (int level = 0; level < LodCount - 1; ++level) {
+			// Largest distance between a circle and the inscribed polygon.
+			const float error = screenRadius * (1 - std::cos(Pi / LodSlices[level]));
+			if (error <= maxError) {
+				return level;
+			}
+		}
+		return LodCount - 1;
+	}
+
+	template <typename Create>
+	const Mesh& MeshCache::getMesh(uint64_t key, Create create) {
+		{
+			std::shared_lock lock{mutex_};
+			if (auto it = meshes_.find(key); it != meshes_.end()) {
+				return it->second;
+			}
+		}
+		// Tessellated without the lock, if two threads race the first mesh is kept.
+		Mesh mesh = create();
+		std::unique_lock lock{mutex_};
+		return meshes_.try_emplace(key, std::move(mesh)).first->second;
+	}
+
+	const Mesh& MeshCache::getCube() {
+		return getMesh(createKey(Primitive::Cube, 0, 0), [] {
+			return createCube();
+		});
+	}
+
+	const Mesh& MeshCache::getSphere(unsigned int slices, unsigned int stacks) {
+		return getMesh(createKey(Primitive::Sphere, slices, stacks), [&] {
+			return createSphere(slices, stacks);
+		});
+	}
+
+	const Mesh& MeshCache::getCylinder(unsigned int slices, unsigned int stacks) {
+		return getMesh(createKey(Primitive::Cylinder, slices, stacks), [&] {
+			return createCylinder(slices, stacks);
+		});
+	}
+
+	const Mesh& MeshCache::getSphereLod(int level) {
+		const unsigned int slices = LodSlices[std::clamp(level, 0, LodCount - 1)];
+		return getSphere(slices, slices / 2);
+	}
+
+	const Mesh& MeshCache::getCylinderLod(int level) {
+		// The radius changes linearly with the height, one stack is enough.
+		return getCylinder(LodSlices[std::clamp(level, 0, LodCount - 1)], 1);
+	}
+
+	uint64_t MeshCache::createKey(Primitive primitive, unsigned int slices, unsigned int stacks) {
+		// 8 bits for the primitive and 28 bits for each tessellation parameter.
+		return (static_cast<uint64_t>(primitive) << 56)
+			| (static_cast<uint64_t>(slices & 0xFFFFFFF) << 28)
+			| (stacks & 0xFFFFFFF);
+	}
+
+}
@@ -0,0 +1,73 @@
+#ifndef ROBOT_MESHCACHE_H
+#define ROBOT_MESHCACHE_H
+
+#include <glm/vec3.hpp>
+
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace robot {
+
+	struct MeshVertex {
+		glm::vec3 position;
+		glm::vec3 normal;
+	};
+
+	/// Indexed triangle mesh in model space.
+	struct Mesh {
+		std::vector<MeshVertex> vertices;
+		std::vector<uint32_t> indices;
+	};
+
+	enum class Primitive : uint8_t {
+		Cube,
+		Sphere,
+		Cylinder
+	};
+
+	/// Unit meshes of the primitives, tessellated once for each set of tessellation
+	/// parameters and kept for the lifetime of the cache. The size is applied when
+	/// the mesh is emitted, so the same mesh is shared by all sizes. Thread safe, shared
+	/// by the geometry builders of parallel jobs.
+	class MeshCache {
+	public:
+		/// Number of tessellation levels of the sphere and the cylinder, level 0 is the coarsest.
+		static constexpr int LodCount = 5;
+
+		/// Returns the coarsest level where the distance between the tessellated and the
+		/// true silhouette is below maxError pixels, for a radius of screenRadius pixels.
+		static int getLodLevel(float screenRadius, float maxError = 0.5f);
+
+		/// Cube with side 1 centered at the origin.
+		const Mesh& getCube();
+
+		/// Sphere with radius 1 centered at the origin, the poles are on the y-axis.
+		const Mesh& getSphere(unsigned int slices, unsigned int stacks);
+
+		/// Cylinder along the z-axis from z = 0 to z = 1. The x and y coordinates are on
+		/// the unit circle (zero for the cap centers) and are meant to be scaled with the
+		/// radius at height z, in order to support different base and top radius.
+		const Mesh& getCylinder(unsigned int slices, unsigned int stacks);
+
+		/// Sphere of the level of detail, see getLodLevel.
+		const Mesh& getSphereLod(int level);
+
+		/// Cylinder of the level of detail, see getLodLevel.
+		const Mesh& getCylinderLod(int level);
+
+	private:
+		static uint64_t createKey(Primitive primitive, unsigned int slices, unsigned int stacks);
+
+		template <typename Create>
+		const Mesh& getMesh(uint64_t key, Create create);
+
+		// Node based, references to the meshes stay valid when inserting.
+		std::unordered_map<uint64_t, Mesh> meshes_;
+		std::shared_mutex mutex_;
+	};
+
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include "meshfile.h"
+
+#include <glm/common.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace robot {
+
+	namespace {
+
+		std::runtime_error createError(const std::string& message, const std::filesystem::path& path) {
+			return std::runtime_error{"[MeshFile] " + message + ": " + path.string()};
+		}
+
+	}
+
+	MappedFile::MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			throw createError("Failed to open", path);
+		}
+		LARGE_INTEGER size{};
+		GetFileSizeEx(file, &size);
+		size_ = static_cast<size_t>(size.QuadPart);
+		if (size_ > 0) {
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping != nullptr) {
+				data_ = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+				// The view keeps the mapping alive.
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+#else
+		int file = open(path.c_str(), O_RDONLY);
+		if (file < 0) {
+			throw createError("Failed to open", path);
+		}
+		struct stat status{};
+		fstat(file, &status);
+		size_ = static_cast<size_t>(status.st_size);
+		if (size_ > 0) {
+			void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+			data_ = data != MAP_FAILED ? static_cast<const std::byte*>(data) : nullptr;
+		}
+		// The mapping keeps the file alive.
+		close(file);
+#endif
+		if (size_ > 0 && data_ == nullptr) {
+			throw createError("Failed to map", path);
+		}
+	}
+
+	MappedFile::~MappedFile() {
+		unmap();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: data_{std::exchange(other.data_, nullptr)}
+		, size_{std::exchange(other.size_, 0)} {
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	void MappedFile::unmap() {
+		if (data_ == nullptr) {
+			return;
+		}
+#ifdef _WIN32
+		UnmapViewOfFile(data_);
+#else
+		munmap(const_cast<std::byte*>(data_), size_);
+#endif
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	MeshFile::MeshFile(const std::filesystem::path& path)
+		: file_{path} {
+
+		auto data = file_.data();
+		if (data.size() < sizeof(MeshFileHeader)) {
+			throw createError("Not a mesh file", path);
+		}
+		header_ = reinterpret_cast<const MeshFileHeader*>(data.data());
+		if (header_->magic != MeshFileHeader::Magic) {
+			throw createError("Not a mesh file", path);
+		}
+		if (header_->version != MeshFileHeader::Version) {
+			throw createError("Unsupported mesh file version", path);
+		}
+		const size_t verticesSize = size_t{header_->vertexCount} * sizeof(MeshVertex);
+		const size_t indicesSize = size_t{header_->indexCount} * sizeof(uint32_t);
+		if (data.size() != sizeof(MeshFileHeader) + verticesSize + indicesSize) {
+			throw createError("Truncated mesh file", path);
+		}
+
+		// The mapping is page aligned and all parts are multiples of 4 bytes.
+		auto vertices = data.subspan(sizeof(MeshFileHeader), verticesSize);
+		auto indices = data.subspan(sizeof(MeshFileHeader) + verticesSize, indicesSize);
+		vertices_ = {reinterpret_cast<const MeshVertex*>(vertices.data()), header_->vertexCount};
+		indices_ = {reinterpret_cast<const uint32_t*>(indices.data()), header_->indexCount};
+
+		// A corrupt or stale file must not make the GPU read outside the vertex buffer.
+		const uint32_t vertexCount = header_->vertexCount;
+		if (std::any_of(indices_.begin(), indices_.end(), [vertexCount](uint32_t index) { return index >= vertexCount; })) {
+			throw createError("Index out of range in mesh file", path);
+		}
+	}
+
+	void writeMeshFile(const std::filesystem::path& path, const Mesh& mesh) {
+		MeshFileHeader header{
+			.vertexCount = static_cast<uint32_t>(mesh.vertices.size()),
+			.indexCount = static_cast<uint32_t>(mesh.indices.size())
+		};
+		if (!mesh.vertices.empty()) {
+			header.min = mesh.vertices.front().position;
+			header.max = mesh.vertices.front().position;
+			for (const auto& vertex : mesh.vertices) {
+				header.min = glm::min(header.min, vertex.position);
+				header.max = glm::max(header.max, vertex.position);
+			}
+		}
+
+		std::ofstream out{path, std::ios::binary | std::ios::trunc};
+		out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		out.write(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(MeshVertex));
+		out.write(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size() * sizeof(uint32_t));
+		if (!out) {
+			throw createError("Failed to write", path);
+		}
+	}
+
+}
@@ -0,0 +1,92 @@
+#ifndef ROBOT_MESHFILE_H
+#define ROBOT_MESHFILE_H
+
+#include "meshcache.h"
+
+#include <glm/vec3.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace robot {
+
+	/// Header of the binary mesh file. It is followed directly by vertexCount MeshVertex
+	/// and indexCount uint32_t indices, in the byte order of the machine, i.e. the file
+	/// is the memory layout of the mesh and is used without parsing.
+	struct MeshFileHeader {
+		static constexpr std::array<char, 4> Magic{'R', 'B', 'M', 'F'};
+		static constexpr uint32_t Version = 1;
+
+		std::array<char, 4> magic = Magic;
+		uint32_t version = Version;
+		uint32_t vertexCount = 0;
+		uint32_t indexCount = 0;
+		glm::vec3 min{0.f};	// Bounding box of the vertices.
+		glm::vec3 max{0.f};
+	};
+
+	static_assert(sizeof(MeshFileHeader) == 40 && sizeof(MeshVertex) == 24, "The mesh file layout must not contain padding");
+
+	/// Read-only memory mapping of a whole file.
+	class MappedFile {
+	public:
+		MappedFile() = default;
+
+		/// Throws std::runtime_error if the file can not be mapped.
+		explicit MappedFile(const std::filesystem::path& path);
+
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		std::span<const std::byte> data() const {
+			return {data_, size_};
+		}
+
+	private:
+		void unmap();
+
+		const std::byte* data_ = nullptr;
+		size_t size_ = 0;
+	};
+
+	/// Mesh file mapped into memory, the vertices and indices point directly into the
+	/// mapping. Pages are only read by the OS when the data is accessed.
+	class MeshFile {
+	public:
+		/// Throws std::runtime_error if the file can not be mapped, is not a mesh file of the
+		/// current version or has an index out of range. The indices are read to check them.
+		explicit MeshFile(const std::filesystem::path& path);
+
+		const MeshFileHeader& getHeader() const {
+			return *header_;
+		}
+
+		std::span<const MeshVertex> vertices() const {
+			return vertices_;
+		}
+
+		std::span<const uint32_t> indices() const {
+			return indices_;
+		}
+
+	private:
+		MappedFile file_;
+		const MeshFileHeader* header_ = nullptr;
+		std::span<const MeshVertex> vertices_;
+		std::span<const uint32_t> indices_;
+	};
+
+	/// Writes the mesh in the mesh file format, throws std::runtime_error on failure.
+	void writeMeshFile(const std::filesystem::path& path, const Mesh& mesh);
+
+}
+
+#endif
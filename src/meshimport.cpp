@@ -0,0 +1,443 @@
+#include "meshimport.h"
+#include "meshfile.h"
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace robot {
+
+	namespace {
+
+		// Corner of a triangle before welding, the normal is not normalized.
+		struct Corner {
+			glm::vec3 position;
+			glm::vec3 normal;
+		};
+
+		struct PositionKey {
+			uint32_t x;
+			uint32_t y;
+			uint32_t z;
+
+			explicit PositionKey(const glm::vec3& position)
+				// Adding zero turns -0 into 0, which must be the same position.
+				: x{std::bit_cast<uint32_t>(position.x + 0.f)}
+				, y{std::bit_cast<uint32_t>(position.y + 0.f)}
+				, z{std::bit_cast<uint32_t>(position.z + 0.f)} {
+			}
+
+			bool operator==(const PositionKey&) const = default;
+		};
+
+		struct PositionKeyHash {
+			size_t operator()(const PositionKey& key) const {
+				return (size_t{key.x} * 73856093) ^ (size_t{key.y} * 19349663) ^ (size_t{key.z} * 83492791);
+			}
+		};
+
+		constexpr uint32_t NoIndex = std::numeric_limits<uint32_t>::max();
+
+		std::runtime_error createError(const std::string& message, const std::filesystem::path& path) {
+			return std::runtime_error{"[MeshImport] " + message + ": " + path.string()};
+		}
+
+		std::vector<char> readFile(const std::filesystem::path& path) {
+			std::ifstream in{path, std::ios::binary};
+			if (!in) {
+				throw createError("Failed to open", path);
+			}
+			return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+		}
+
+		// Adds the triangle with the face normal weighted by the area, degenerate triangles are skipped.
+		void addTriangle(std::vector<Corner>& corners, const glm::vec3& p1, const glm::vec3& p2, const glm::vec3& p3) {
+			const glm::vec3 normal = glm::cross(p2 - p1, p3 - p1);
+			if (glm::dot(normal, normal) == 0) {
+				return;
+			}
+			corners.push_back(Corner{p1, normal});
+			corners.push_back(Corner{p2, normal});
+			corners.push_back(Corner{p3, normal});
+		}
+
+		std::vector<Corner> readStl(const std::filesystem::path& path) {
+			const auto data = readFile(path);
+			std::vector<Corner> corners;
+
+			constexpr size_t HeaderSize = 84;
+			constexpr size_t FacetSize = 50;
+			uint32_t facetCount = 0;
+			if (data.size() >= HeaderSize) {
+				std::memcpy(&facetCount, data.data() + 80, sizeof(facetCount));
+			}
+			// ASCII files start with "solid", but so do some binary files.
+			if (data.size() >= HeaderSize && data.size() == HeaderSize + FacetSize * size_t{facetCount}) {
+				corners.reserve(size_t{facetCount} * 3);
+				for (size_t i = 0; i < facetCount; ++i) {
+					// The stored normal is often wrong, it is computed from the vertices instead.
+					float values[9];
+					std::memcpy(values, data.data() + HeaderSize + FacetSize * i + 12, sizeof(values));
+					addTriangle(corners,
+						glm::vec3{values[0], values[1], values[2]},
+						glm::vec3{values[3], values[4], values[5]},
+						glm::vec3{values[6], values[7], values[8]}
+					);
+				}
+				return corners;
+			}
+
+			if (std::string_view{data.data(), data.size()}.starts_with("solid")) {
+				std::istringstream in{std::string{data.data(), data.size()}};
+				glm::vec3 triangle[3];
+				int size = 0;
+				std::string token;
+				while (in >> token) {
+					if (token == "vertex") {
+						in >> triangle[size].x >> triangle[size].y >> triangle[size].z;
+						if (++size == 3) {
+							addTriangle(corners, triangle[0], triangle[1], triangle[2]);
+							size = 0;
+						}
+					}
+				}
+				if (in.bad() || size != 0) {
+					throw createError("Invalid ASCII STL file", path);
+				}
+				return corners;
+			}
+			throw createError("Invalid STL file", path);
+		}
+
+		std::vector<Corner> readObj(const std::filesystem::path& path) {
+			std::ifstream in{path};
+			if (!in) {
+				throw createError("Failed to open", path);
+			}
+			std::vector<glm::vec3> positions;
+			std::vector<glm::vec3> normals;
+			std::vector<Corner> corners;
+
+			// One based, negative indices are relative to the end.
+			auto resolve = [&](long index, size_t size) {
+				const long resolved = index < 0 ? static_cast<long>(size) + index : index - 1;
+				if (resolved < 0 || resolved >= static_cast<long>(size)) {
+					throw createError("Invalid OBJ index", path);
+				}
+				return static_cast<size_t>(resolved);
+			};
+
+			std::string line;
+			std::vector<std::pair<size_t, size_t>> face; // Position and normal index, NoIndex if no normal.
+			while (std::getline(in, line)) {
+				std::istringstream stream{line};
+				std::string type;
+				stream >> type;
+				if (type == "v") {
+					glm::vec3 position;
+					stream >> position.x >> position.y >> position.z;
+					positions.push_back(position);
+				} else if (type == "vn") {
+					glm::vec3 normal;
+					stream >> normal.x >> normal.y >> normal.z;
+					normals.push_back(normal);
+				} else if (type == "f") {
+					// Formats: v, v/vt, v//vn and v/vt/vn.
+					face.clear();
+					std::string vertex;
+					while (stream >> vertex) {
+						const auto first = vertex.find('/');
+						const auto last = vertex.rfind('/');
+						const size_t position = resolve(std::stol(vertex.substr(0, first)), positions.size());
+						size_t normal = NoIndex;
+						if (first != std::string::npos && last != first && last + 1 < vertex.size()) {
+							normal = resolve(std::stol(vertex.substr(last + 1)), normals.size());
+						}
+						face.emplace_back(position, normal);
+					}
+					// Convex polygons are split into a triangle fan.
+					for (size_t i = 2; i < face.size(); ++i) {
+						const size_t start = corners.size();
+						addTriangle(corners, positions[face[0].first], positions[face[i - 1].first], positions[face[i].first]);
+						if (corners.size() == start) {
+							continue;
+						}
+						const size_t triangle[] = {0, i - 1, i};
+						for (int k = 0; k < 3; ++k) {
+							if (auto normal = face[triangle[k]].second; normal != NoIndex) {
+								corners[start + k].normal = normals[normal];
+							}
+						}
+					}
+				}
+			}
+			return corners;
+		}
+
+		// Welds corners at the same position if the angle between the normals is below the crease angle.
+		Mesh weld(const std::vector<Corner>& corners, float creaseAngle) {
+			const float minCos = std::cos(creaseAngle);
+
+			Mesh mesh;
+			mesh.indices.reserve(corners.size());
+			std::vector<glm::vec3> firstNormals; // Normalized normal of the first corner of each vertex.
+			std::vector<uint32_t> nextVertex;	// Linked list of the vertices at the same position.
+			std::unordered_map<PositionKey, uint32_t, PositionKeyHash> vertexAtPosition;
+			vertexAtPosition.reserve(corners.size() / 3);
+
+			for (const auto& corner : corners) {
+				const glm::vec3 normal = glm::normalize(corner.normal);
+				auto [it, inserted] = vertexAtPosition.try_emplace(PositionKey{corner.position}, NoIndex);
+				uint32_t index = it->second;
+				while (index != NoIndex && glm::dot(firstNormals[index], normal) < minCos) {
+					index = nextVertex[index];
+				}
+				if (index == NoIndex) {
+					index = static_cast<uint32_t>(mesh.vertices.size());
+					mesh.vertices.push_back(MeshVertex{corner.position, glm::vec3{0.f}});
+					firstNormals.push_back(normal);
+					nextVertex.push_back(it->second);
+					it->second = index;
+				}
+				mesh.vertices[index].normal += corner.normal;
+				mesh.indices.push_back(index);
+			}
+			for (auto& vertex : mesh.vertices) {
+				vertex.normal = glm::normalize(vertex.normal);
+			}
+			return mesh;
+		}
+
+		std::string toLower(std::string text) {
+			std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) {
+				return static_cast<char>(std::tolower(c));
+			});
+			return text;
+		}
+
+		// Parameters from Tom Forsyth, "Linear-Speed Vertex Cache Optimisation".
+		constexpr int CacheSize = 32;
+		constexpr float CacheDecayPower = 1.5f;
+		constexpr float LastTriangleScore = 0.75f;
+		constexpr float ValenceBoostScale = 2.f;
+		constexpr float ValenceBoostPower = 0.5f;
+
+		float computeVertexScore(int cachePosition, uint32_t remainingTriangles) {
+			if (remainingTriangles == 0) {
+				return -1.f;
+			}
+			float score = 0;
+			if (cachePosition >= 0 && cachePosition < 3) {
+				// Used by the last triangle, a fixed score independent of the order inside it.
+				score = LastTriangleScore;
+			} else if (cachePosition >= 3) {
+				score = std::pow(1.f - static_cast<float>(cachePosition - 3) / (CacheSize - 3), CacheDecayPower);
+			}
+			// Vertices with few triangles left are preferred, to get rid of them.
+			return score + ValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -ValenceBoostPower);
+		}
+
+	}
+
+	Mesh importMesh(const std::filesystem::path& path, float creaseAngle) {
+		const auto extension = toLower(path.extension().string());
+		if (extension == ".stl") {
+			return weld(readStl(path), creaseAngle);
+		}
+		if (extension == ".obj") {
+			return weld(readObj(path), creaseAngle);
+		}
+		throw createError("Unsupported mesh format", path);
+	}
+
+	void optimizeVertexCache(Mesh& mesh) {
+		const size_t triangleCount = mesh.indices.size() / 3;
+		const size_t vertexCount = mesh.vertices.size();
+		if (triangleCount == 0) {
+			return;
+		}
+
+		// The triangles of each vertex, the first remainingTriangles[v] are not emitted yet.
+		std::vector<uint32_t> offsets(vertexCount + 1, 0);
+		for (auto index : mesh.indices) {
+			++offsets[index + 1];
+		}
+		for (size_t v = 0; v < vertexCount; ++v) {
+			offsets[v + 1] += offsets[v];
+		}
+		std::vector<uint32_t> remainingTriangles(vertexCount);
+		for (size_t v = 0; v < vertexCount; ++v) {
+			remainingTriangles[v] = offsets[v + 1] - offsets[v];
+		}
+		std::vector<uint32_t> vertexTriangles(offsets.back());
+		{
+			std::vector<uint32_t> size(vertexCount, 0);
+			for (size_t i = 0; i < triangleCount * 3; ++i) {
+				const uint32_t v = mesh.indices[i];
+				vertexTriangles[offsets[v] + size[v]++] = static_cast<uint32_t>(i / 3);
+			}
+		}
+
+		std::vector<int> cachePositions(vertexCount, -1);
+		std::vector<float> vertexScores(vertexCount);
+		for (size_t v = 0; v < vertexCount; ++v) {
+			vertexScores[v] = computeVertexScore(-1, remainingTriangles[v]);
+		}
+		auto computeTriangleScore = [&](size_t triangle) {
+			return vertexScores[mesh.indices[triangle * 3]] + vertexScores[mesh.indices[triangle * 3 + 1]] + vertexScores[mesh.indices[triangle * 3 + 2]];
+		};
+		std::vector<float> triangleScores(triangleCount);
+		std::vector<bool> emitted(triangleCount, false);
+		for (size_t t = 0; t < triangleCount; ++t) {
+			triangleScores[t] = computeTriangleScore(t);
+		}
+
+		std::vector<uint32_t> indices;
+		indices.reserve(triangleCount * 3);
+		std::vector<uint32_t> cache;
+		std::vector<uint32_t> newCache;
+		cache.reserve(CacheSize + 3);
+		newCache.reserve(CacheSize + 3);
+
+		size_t best = std::distance(triangleScores.begin(), std::max_element(triangleScores.begin(), triangleScores.end()));
+		size_t nextUnemitted = 0;
+		for (size_t n = 0; n < triangleCount; ++n) {
+			if (best == NoIndex) {
+				// Nothing left in the cache, continue with any triangle.
+				while (emitted[nextUnemitted]) {
+					++nextUnemitted;
+				}
+				best = nextUnemitted;
+			}
+			emitted[best] = true;
+
+			newCache.clear();
+			for (int k = 0; k < 3; ++k) {
+				const uint32_t v = mesh.indices[best * 3 + k];
+				indices.push_back(v);
+				if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+					newCache.push_back(v);
+				}
+				auto begin = vertexTriangles.begin() + offsets[v];
+				auto end = begin + remainingTriangles[v];
+				if (auto it = std::find(begin, end, static_cast<uint32_t>(best)); it != end) {
+					std::iter_swap(it, end - 1);
+					--remainingTriangles[v];
+				}
+			}
+			for (auto v : cache) {
+				if (std::find(newCache.begin(), newCache.end(), v) == newCache.end()) {
+					newCache.push_back(v);
+				}
+			}
+
+			// Vertices pushed out of the cache are updated as well.
+			for (size_t i = 0; i < newCache.size(); ++i) {
+				const uint32_t v = newCache[i];
+				cachePositions[v] = i < CacheSize ? static_cast<int>(i) : -1;
+				vertexScores[v] = computeVertexScore(cachePositions[v], remainingTriangles[v]);
+			}
+
+			best = NoIndex;
+			float bestScore = -1.f;
+			for (auto v : newCache) {
+				for (uint32_t i = 0; i < remainingTriangles[v]; ++i) {
+					const uint32_t triangle = vertexTriangles[offsets[v] + i];
+					triangleScores[triangle] = computeTriangleScore(triangle);
+					if (triangleScores[triangle] > bestScore) {
+						bestScore = triangleScores[triangle];
+						best = triangle;
+					}
+				}
+			}
+			newCache.resize(std::min<size_t>(newCache.size(), CacheSize));
+			std::swap(cache, newCache);
+		}
+
+		// Vertices in the order of first use, unused vertices are removed.
+		std::vector<uint32_t> remap(vertexCount, NoIndex);
+		std::vector<MeshVertex> vertices;
+		vertices.reserve(vertexCount);
+		for (auto& index : indices) {
+			if (remap[index] == NoIndex) {
+				remap[index] = static_cast<uint32_t>(vertices.size());
+				vertices.push_back(mesh.vertices[index]);
+			}
+			index = remap[index];
+		}
+		mesh.vertices = std::move(vertices);
+		mesh.indices = std::move(indices);
+	}
+
+	float computeAcmr(std::span<const uint32_t> indices, unsigned int cacheSize) {
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0) {
+			return 0;
+		}
+		std::vector<uint32_t> cache;
+		size_t oldest = 0;
+		size_t misses = 0;
+		for (auto index : indices) {
+			if (std::find(cache.begin(), cache.end(), index) != cache.end()) {
+				continue;
+			}
+			++misses;
+			if (cache.size() < cacheSize) {
+				cache.push_back(index);
+			} else {
+				cache[oldest] = index;
+				oldest = (oldest + 1) % cacheSize;
+			}
+		}
+		return static_cast<float>(misses) / triangleCount;
+	}
+
+	std::filesystem::path updateMeshFile(const std::filesystem::path& source) {
+		auto meshPath = source;
+		meshPath.replace_extension(".rbmesh");
+
+		std::error_code error;
+		if (!std::filesystem::exists(source, error)) {
+			return meshPath;
+		}
+		const auto sourceTime = std::filesystem::last_write_time(source, error);
+		if (std::filesystem::exists(meshPath, error) && std::filesystem::last_write_time(meshPath, error) >= sourceTime) {
+			return meshPath;
+		}
+
+		Mesh mesh = importMesh(source);
+		optimizeVertexCache(mesh);
+		// Written to a temporary file first, a partially written mesh file is never used.
+		auto temporaryPath = meshPath;
+		temporaryPath += ".tmp";
+		writeMeshFile(temporaryPath, mesh);
+		std::filesystem::rename(temporaryPath, meshPath);
+		return meshPath;
+	}
+
+	std::filesystem::path findMeshSource(const std::filesystem::path& path) {
+		// The mesh file last, it is updated from a newer model.
+		for (const char* extension : {".stl", ".obj", ".rbmesh"}) {
+			auto source = path;
+			source.replace_extension(extension);
+			std::error_code error;
+			if (std::filesystem::exists(source, error)) {
+				return source;
+			}
+		}
+		return {};
+	}
+
+}
@@ -0,0 +1,36 @@
+#ifndef ROBOT_MESHIMPORT_H
+#define ROBOT_MESHIMPORT_H
+
+#include "meshcache.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace robot {
+
+	/// Imports a binary or ASCII STL file, or an OBJ file (chosen by the extension). Vertices at
+	/// the same position are welded and given a smooth normal, except across edges sharper
+	/// than creaseAngle (radians). Throws std::runtime_error if the file can not be read.
+	Mesh importMesh(const std::filesystem::path& path, float creaseAngle = 0.5f);
+
+	/// Reorders the triangles for the post-transform vertex cache (Forsyth's algorithm) and
+	/// then the vertices in the order they are first used, for linear vertex fetches.
+	void optimizeVertexCache(Mesh& mesh);
+
+	/// Average number of vertex shader invocations per triangle for a FIFO vertex cache,
+	/// between 0.5 (ideal) and 3 (no reuse).
+	float computeAcmr(std::span<const uint32_t> indices, unsigned int cacheSize = 16);
+
+	/// Returns the path of the mesh file next to source, with the extension ".rbmesh". The mesh
+	/// file is imported, optimized and written first if it is missing or older than source.
+	/// Only the mesh file is needed if source does not exist.
+	std::filesystem::path updateMeshFile(const std::filesystem::path& source);
+
+	/// Returns the existing source of the mesh, path with the extension ".stl", ".obj" or
+	/// ".rbmesh" in that order, or an empty path if there is none.
+	std::filesystem::path findMeshSource(const std::filesystem::path& path);
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "meshstreamer.h"
+#include "meshfile.h"
+#include "meshimport.h"
+
+#include <glm/geometric.hpp>
+#include <spdlog/spdlog.h>
+
+#include <stdexcept>
+
+namespace robot {
+
+	void MeshStreamer::start(SDL_GPUDevice* gpuDevice, std::vector<std::filesystem::path> sources) {
+		size_ = sources.size();
+		entries_ = std::make_unique<Entry[]>(size_);
+		thread_ = std::jthread{[this, gpuDevice, sources = std::move(sources)](std::stop_token stopToken) mutable {
+			run(stopToken, gpuDevice, std::move(sources));
+		}};
+	}
+
+	void MeshStreamer::run(std::stop_token stopToken, SDL_GPUDevice* gpuDevice, std::vector<std::filesystem::path> sources) {
+		for (size_t i = 0; i < sources.size() && !stopToken.stop_requested(); ++i) {
+			try {
+				load(gpuDevice, sources[i], entries_[i]);
+			} catch (const std::exception& e) {
+				spdlog::warn("[MeshStreamer] {}", e.what());
+			}
+		}
+	}
+
+	void MeshStreamer::load(SDL_GPUDevice* gpuDevice, const std::filesystem::path& source, Entry& entry) {
+		MeshFile file{updateMeshFile(source)};
+		auto vertices = file.vertices();
+		auto indices = file.indices();
+		if (indices.empty()) {
+			throw std::runtime_error{"[MeshStreamer] Empty mesh: " + source.string()};
+		}
+
+		SDL_GPUBuffer* vertexBuffer = entry.vertexBuffer.get(gpuDevice, SDL_GPU_BUFFERUSAGE_VERTEX, vertices);
+		SDL_GPUBuffer* indexBuffer = entry.indexBuffer.get(gpuDevice, SDL_GPU_BUFFERUSAGE_INDEX, indices);
+
+		// The mapped pages are read once, when copied into the transfer buffers.
+		sdl::TransferBuffer vertexTransferBuffer;
+		sdl::TransferBuffer indexTransferBuffer;
+		SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(gpuDevice);
+		SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+		uploadToGpuBuffer(copyPass, vertexTransferBuffer.get(gpuDevice, vertices, false), vertexBuffer, vertices.size_bytes(), false);
+		uploadToGpuBuffer(copyPass, indexTransferBuffer.get(gpuDevice, indices, false), indexBuffer, indices.size_bytes(), false);
+		SDL_EndGPUCopyPass(copyPass);
+
+		// Waits on this thread, the transfer buffers must live until the copy is done.
+		SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+		SDL_WaitForGPUFences(gpuDevice, true, &fence, 1);
+		SDL_ReleaseGPUFence(gpuDevice, fence);
+
+		const auto& header = file.getHeader();
+		entry.mesh = GpuMesh{
+			.vertexBuffer = vertexBuffer,
+			.indexBuffer = indexBuffer,
+			.indexCount = static_cast<Uint32>(indices.size()),
+			.center = 0.5f * (header.min + header.max),
+			.radius = 0.5f * glm::length(header.max - header.min)
+		};
+		entry.loaded.store(true, std::memory_order_release);
+		spdlog::info("[MeshStreamer] Loaded {} ({} triangles)", source.string(), indices.size() / 3);
+	}
+
+}
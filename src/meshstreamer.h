@@ -0,0 +1,71 @@
+#ifndef ROBOT_MESHSTREAMER_H
+#define ROBOT_MESHSTREAMER_H
+
+#include "graphic.h"
+
+#include <sdl/gpu.h>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace robot {
+
+	/// Loads meshes to the GPU on a background thread, so the render loop starts without
+	/// waiting. Each source is converted to a mesh file once (see updateMeshFile), which is
+	/// then memory mapped and copied directly into the transfer buffer. The meshes become
+	/// available one by one, a mesh that fails to load is logged and stays unavailable.
+	class MeshStreamer {
+	public:
+		MeshStreamer() = default;
+
+		MeshStreamer(const MeshStreamer&) = delete;
+		MeshStreamer& operator=(const MeshStreamer&) = delete;
+
+		/// Starts loading the sources, the thread is stopped and joined in the destructor.
+		/// Must only be called once.
+		void start(SDL_GPUDevice* gpuDevice, std::vector<std::filesystem::path> sources);
+
+		/// Returns the mesh for the source with the index, or nullptr if not loaded yet.
+		const GpuMesh* getMesh(size_t index) const {
+			if (index >= size_ || !entries_[index].loaded.load(std::memory_order_acquire)) {
+				return nullptr;
+			}
+			return &entries_[index].mesh;
+		}
+
+		/// Returns true if all meshes are loaded.
+		bool isLoaded() const {
+			for (size_t i = 0; i < size_; ++i) {
+				if (!entries_[i].loaded.load(std::memory_order_acquire)) {
+					return false;
+				}
+			}
+			return size_ > 0;
+		}
+
+	private:
+		struct Entry {
+			GpuMesh mesh;
+			std::atomic<bool> loaded = false;	// Published after mesh is written.
+
+			sdl::Buffer vertexBuffer;
+			sdl::Buffer indexBuffer;
+		};
+
+		void run(std::stop_token stopToken, SDL_GPUDevice* gpuDevice, std::vector<std::filesystem::path> sources);
+
+		void load(SDL_GPUDevice* gpuDevice, const std::filesystem::path& source, Entry& entry);
+
+		std::unique_ptr<Entry[]> entries_;
+		size_t size_ = 0;
+
+		// Declared last, the thread is joined before the buffers are released.
+		std::jthread thread_;
+	};
+
+}
+
+#endif
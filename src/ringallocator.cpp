@@ -0,0 +1,79 @@
+#include "ringallocator.h"
+
+#include <stdexcept>
+
+namespace robot {
+
+	namespace {
+
+		size_t alignUp(size_t offset, size_t alignment) {
+			return (offset + alignment - 1) / alignment * alignment;
+		}
+
+	}
+
+	RingAllocator::RingAllocator(size_t capacity)
+		: capacity_{capacity} {
+	}
+
+	size_t RingAllocator::allocate(size_t size, size_t alignment) {
+		if (used_ == 0) {
+			// Nothing in use, start over to get the largest contiguous space. Frames in
+			// flight without any bytes keep their end, it is ignored when retired.
+			head_ = 0;
+			tail_ = 0;
+		}
+		size_t offset = alignUp(head_, alignment);
+		// Wrapped if the used space continues at the start, head == tail is then full.
+		const bool wrapped = head_ < tail_ || (head_ == tail_ && used_ > 0);
+		if (!wrapped) {
+			// The free space is after the head and before the tail.
+			if (offset + size > capacity_) {
+				if (size > tail_) {
+					return NoSpace;
+				}
+				// Wraps, the end of the ring is skipped.
+				offset = 0;
+			}
+		} else if (offset + size > tail_) {
+			return NoSpace;
+		}
+		const size_t bytes = (offset >= head_ ? offset - head_ : capacity_ - head_ + offset) + size;
+		used_ += bytes;
+		frameBytes_ += bytes;
+		head_ = offset + size;
+		return offset;
+	}
+
+	void RingAllocator::endFrame() {
+		if (frameCount_ == MaxFrames) {
+			throw std::length_error{"[RingAllocator] Too many frames in flight"};
+		}
+		frames_[(firstFrame_ + frameCount_) % MaxFrames] = Frame{.end = head_, .bytes = frameBytes_};
+		++frameCount_;
+		frameBytes_ = 0;
+	}
+
+	void RingAllocator::retireFrame() {
+		if (frameCount_ == 0) {
+			throw std::logic_error{"[RingAllocator] No frame in flight"};
+		}
+		const Frame& frame = frames_[firstFrame_];
+		if (frame.bytes > 0) {
+			tail_ = frame.end;
+			used_ -= frame.bytes;
+		}
+		firstFrame_ = (firstFrame_ + 1) % MaxFrames;
+		--frameCount_;
+	}
+
+	void RingAllocator::resize(size_t capacity) {
+		if (used_ != 0) {
+			throw std::logic_error{"[RingAllocator] Resized while in use"};
+		}
+		capacity_ = capacity;
+		head_ = 0;
+		tail_ = 0;
+	}
+
+}
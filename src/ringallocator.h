@@ -0,0 +1,65 @@
+#ifndef ROBOT_RINGALLOCATOR_H
+#define ROBOT_RINGALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace robot {
+
+	/// Suballocates offsets in a ring of bytes shared by the frames in flight. The
+	/// allocations of a frame are freed together, oldest frame first, when the GPU is
+	/// done with it. Only offsets, the memory itself is owned by the caller.
+	class RingAllocator {
+	public:
+		static constexpr size_t MaxFrames = 8;
+		static constexpr size_t NoSpace = std::numeric_limits<size_t>::max();
+
+		explicit RingAllocator(size_t capacity = 0);
+
+		/// Returns the offset of size bytes in the current frame, or NoSpace if the
+		/// frames in flight use the space.
+		size_t allocate(size_t size, size_t alignment = 16);
+
+		/// Ends the current frame, its allocations are in use until it is retired.
+		/// Throws std::length_error if MaxFrames are already in flight.
+		void endFrame();
+
+		/// Frees the allocations of the oldest frame in flight.
+		void retireFrame();
+
+		/// Changes the capacity, throws std::logic_error unless everything is freed.
+		void resize(size_t capacity);
+
+		size_t framesInFlight() const {
+			return frameCount_;
+		}
+
+		size_t capacity() const {
+			return capacity_;
+		}
+
+		/// Bytes in use by the frames in flight and the current frame, including padding.
+		size_t used() const {
+			return used_;
+		}
+
+	private:
+		struct Frame {
+			size_t end;
+			size_t bytes;
+		};
+
+		size_t capacity_ = 0;
+		size_t head_ = 0;	// Next free byte.
+		size_t tail_ = 0;	// Start of the oldest frame in flight.
+		size_t used_ = 0;
+		size_t frameBytes_ = 0;	// Used by the current frame.
+		std::array<Frame, MaxFrames> frames_{};	// Queue of the frames in flight.
+		size_t firstFrame_ = 0;
+		size_t frameCount_ = 0;
+	};
+
+}
+
+#endif
@@ -3,106 +3,51 @@
 #include <glm/mat4x4.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
 
 #include <cmath>
 #include <algorithm>
+#include <random>
 
 namespace robot {
 
-	namespace {
-
-		/// Converts the joint angles for the C-code for the robot to angles
-		/// suited for the DH-representation (and the real robot).
-		std::array<float, 6> convertAngles(const std::array<float, 6>& angles) {
-			// Angles[2] is defined relative to the horizontal plane
-			return {
-				angles[0],
-				angles[1] - Pi / 2,
-				angles[2] + Pi - angles[1],
-				angles[3],
-				(angles[4] + Pi) * (-1),
-				angles[5] - Pi
-			};
+	void RobotGraphics::draw(GeometryBuilder& graphic, const std::array<float, 6>& angles) {
+		// Only the joints after the first changed angle are recomputed.
+		kinematicsCache_.update(angles);
+		const auto& frames = kinematicsCache_.getFrames();
+		for (size_t i = 0; i < frames.size(); ++i) {
+			jointPositions_[i] = frames[i][3];
 		}
-	}
-
-	RobotGraphics::RobotGraphics() {
-		initDefaultDH();
-	};
-
-	glm::mat4 RobotGraphics::getH(float theta, int n) const {
-		// Using the standard DH-representation.
-		// GLM uses column-major ordering, so we must transpose
-		float ca = std::cos(dh_.alpha[n]);
-		float sa = std::sin(dh_.alpha[n]);
-		float ct = std::cos(theta);
-		float st = std::sin(theta);
-
-		return glm::mat4{
-			 ct,                       st,        0, 0,
-			-st * ca,             ct * ca,       sa, 0,
-			 st * sa,            -ct * sa,       ca, 0,
-			 dh_.a[n] * ct, dh_.a[n] * st, dh_.d[n], 1
-		};
-	}
-
-	void RobotGraphics::draw(Graphic& graphic, const std::array<float, 6>& angles, int viewportWidth, int viewportHeight) {
-		auto thetas = convertAngles(angles);
-
-		glm::mat4 h1 = getH(thetas[0], 0);
-		glm::mat4 h2 = getH(thetas[1], 1);
-		glm::mat4 h3 = getH(thetas[2], 2);
-		glm::mat4 h4 = getH(thetas[3], 3);
-		glm::mat4 h5 = getH(thetas[4], 4);
-		glm::mat4 h6 = getH(thetas[5], 5);
-
-		glm::vec4 zero{0, 0, 0, 1.f};
-		jointPositions_[0] = zero;
-		jointPositions_[1] = h1 * zero;
-		jointPositions_[2] = h1 * h2 * zero;
-		jointPositions_[3] = h1 * h2 * h3 * zero;
-		jointPositions_[4] = h1 * h2 * h3 * h4 * zero;
-		jointPositions_[5] = h1 * h2 * h3 * h4 * h5 * zero;
-		glm::mat4 h = h1 * h2 * h3 * h4 * h5 * h6;
-		jointPositions_[6] = h * zero; //pos[6] = TCP!
-
-		// Draw the links of the robot.
-		auto color = sdl::Color::createU32(230, 100, 40);
-
-		graphic.pushMatrix(); // Bas-klumpen som roboten sitter på
-		graphic.scale(glm::vec3{1.0f, 0.8f, 0.3f});
-		graphic.translate(glm::vec3{0.0f, 0.0f, 0.15f});
-		graphic.addSolidCube(0.3f, color);
-		graphic.popMatrix();
-
-		graphic.pushMatrix();
-		drawCylinderLink(graphic, glm::vec3{jointPositions_[0]}, glm::vec3{jointPositions_[1]}, 0.05f, 0.05f, color);
-		graphic.translate(glm::vec3{0.0f, 0.0f, 0.05f});
-		graphic.addSolidSphere(0.05f * 1.8f, 10, 5, color);
-		graphic.popMatrix();
-
-		graphic.pushMatrix();
-		drawCylinderLink(graphic, glm::vec3{jointPositions_[1]}, glm::vec3{jointPositions_[2]}, 0.05f, 0.03f, color);
-		graphic.addSolidSphere(0.05f * 1.4f, 10, 3, color);
-		graphic.popMatrix();
-
-		graphic.pushMatrix();
-		drawCylinderLink(graphic, glm::vec3{jointPositions_[3]}, glm::vec3{jointPositions_[5]}, 0.03f, 0.02f, color);
-		graphic.addSolidSphere(0.03f * 1.4f, 10, 5, color);
-		graphic.popMatrix();
+		const glm::mat4& h = frames[6]; //pos[6] = TCP!
 
-		graphic.pushMatrix();
-		drawCylinderLink(graphic, glm::vec3{jointPositions_[5]}, glm::vec3{jointPositions_[6]}, 0.02f, 0.01f, color);
-		graphic.addSolidSphere(0.02f * 1.4f, 10, 3, color);
-		graphic.popMatrix();
+		// Everything drawn is within the reach of the arm, the base frame included.
+		const auto& dh = kinematicsCache_.getKinematics().getDH();
+		float reach = 0.5f;
+		for (int i = 0; i < 6; ++i) {
+			reach += std::abs(dh.a[i]) + std::abs(dh.d[i]);
+		}
+		if (!graphic.isVisible(glm::vec3{0.f}, reach)) {
+			return;
+		}
 
-		graphic.pushMatrix();
-		graphic.translate(glm::vec3{jointPositions_[6]});
-		graphic.addSolidSphere(0.01f * 1.1f, 3, 3, color);
-		graphic.popMatrix();
+		if (hasLinkMeshes()) {
+			drawLinkMeshes(graphic, frames);
+		} else if (impostors_) {
+			drawImpostorLinks(graphic, frames);
+		} else if (skinning_) {
+			if (skinnedMesh_.isDirty()) {
+				// Recorded once in a reference configuration, each link relative to its frame.
+				graphic.beginStatic(skinnedMesh_);
+				drawLinks(graphic, kinematicsCache_.getKinematics().getFrames({}), true);
+				graphic.endStatic();
+			}
+			graphic.drawStatic(skinnedMesh_, frames);
+		} else {
+			drawLinks(graphic, frames, false);
+		}
 
 		// Draws the TCP frame.
-		drawFrame(graphic, h, 0.2f, viewportWidth, viewportHeight);
+		drawFrame(graphic, h, 0.2f);
 
 		// Draws base frame.
 		drawFrame(graphic,
@@ -112,12 +57,16 @@ namespace robot {
 				0, 0, 1, 0.005f,
 				0, 0, 0, 1
 			}, 
-			0.4f,
-			viewportWidth, viewportHeight
+			0.4f
 		);
 	}
 
-	void RobotGraphics::drawFrame(Graphic& graphic, const glm::mat4& h, float size, int viewportWidth, int viewportHeight) const {
+	void RobotGraphics::setSkinning(bool skinning) {
+		// The legacy vertex has no room for the link index.
+		skinning_ = skinning && Vertex::HasTransformIndex;
+	}
+
+	void RobotGraphics::drawFrame(GeometryBuilder& graphic, const glm::mat4& h, float size) const {
 		float pixelSize = 1.8f;
 
 		glm::vec3 origin = h[3];
@@ -126,38 +75,67 @@ namespace robot {
 		graphic.addLine(
 			origin,
 			origin + xAxis * size,
-			pixelSize, sdl::color::Red, viewportWidth, viewportHeight
+			pixelSize, sdl::color::Red
 		);
 		glm::vec3 yAxis = h[1];
 		graphic.addLine(
 			origin,
 			origin + yAxis * size,
-			pixelSize, sdl::color::Green, viewportWidth, viewportHeight
+			pixelSize, sdl::color::Green
 		);
 		glm::vec3 zAxis = h[2];
 		graphic.addLine(
 			origin,
 			origin + zAxis * size,
-			pixelSize, sdl::color::Blue, viewportWidth, viewportHeight
+			pixelSize, sdl::color::Blue
 		);
 	}
 
-	void RobotGraphics::drawWorkspace(Graphic& graphic, int viewPortWidht, int viewPortHeight) const {
-		//draw a square
-		graphic.addLine(workspacePositions_[0], workspacePositions_[1], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[1], workspacePositions_[2], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[2], workspacePositions_[3], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[3], workspacePositions_[0], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		////draw a square
-		graphic.addLine(workspacePositions_[4], workspacePositions_[5], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[5], workspacePositions_[6], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[6], workspacePositions_[7], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[7], workspacePositions_[4], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		////draw the lines connecting the both squares
-		graphic.addLine(workspacePositions_[0], workspacePositions_[4], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[1], workspacePositions_[5], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[2], workspacePositions_[6], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
-		graphic.addLine(workspacePositions_[3], workspacePositions_[7], 3.f, sdl::color::White, viewPortWidht, viewPortHeight);
+	void RobotGraphics::drawReachableTcps(GeometryBuilder& graphic) {
+		if (reachableTcps_.empty()) {
+			constexpr size_t Samples = 4096;
+			JointBatch angles;
+			angles.resize(Samples);
+			std::mt19937 random{1};
+			std::uniform_real_distribution<float> angle{-glm::pi<float>(), glm::pi<float>()};
+			for (auto& joint : angles.angles) {
+				for (auto& value : joint) {
+					value = angle(random);
+				}
+			}
+			PoseBatch poses;
+			kinematicsCache_.getKinematics().getTcpBatch(angles, poses);
+
+			reachableTcps_.resize(Samples);
+			for (size_t i = 0; i < Samples; ++i) {
+				reachableTcps_[i] = glm::vec3{poses.position[0][i], poses.position[1][i], poses.position[2][i]};
+			}
+			const auto [min, max] = std::minmax_element(reachableTcps_.begin(), reachableTcps_.end(), [](const glm::vec3& a, const glm::vec3& b) {
+				return a.z < b.z;
+			});
+			reachableMinZ_ = min->z;
+			reachableMaxZ_ = max->z;
+		}
+
+		const float height = std::max(reachableMaxZ_ - reachableMinZ_, 1e-6f);
+		for (const auto& tcp : reachableTcps_) {
+			const float t = (tcp.z - reachableMinZ_) / height;
+			graphic.addSphereImpostor(tcp, 0.01f, sdl::Color{t, 0.5f, 1.f - t, 1.f});
+		}
+	}
+
+	void RobotGraphics::drawWorkspace(GeometryBuilder& graphic) {
+		if (workspace_.isDirty()) {
+			graphic.beginStatic(workspace_);
+			for (int i = 0; i < 4; ++i) {
+				// The lower and upper square and the lines connecting them.
+				graphic.addLineSegment(workspacePositions_[i], workspacePositions_[(i + 1) % 4], sdl::color::White);
+				graphic.addLineSegment(workspacePositions_[i + 4], workspacePositions_[(i + 1) % 4 + 4], sdl::color::White);
+				graphic.addLineSegment(workspacePositions_[i], workspacePositions_[i + 4], sdl::color::White);
+			}
+			graphic.endStatic();
+		}
+		graphic.drawStatic(workspace_);
 	}
 
 	void RobotGraphics::setWorkspace(float xMin, float yMin, float zMin,
@@ -177,30 +155,103 @@ namespace robot {
 			workspacePositions_[i] = hBase2rBase * workspacePositions_[i];
 			workspacePositions_[i] = workspacePositions_[i] * 0.001f; // graphics is in meters
 		}
+		workspace_.invalidate();
 	}
 
 	// --------------------- Private functions ---------------------
 
-	void RobotGraphics::initDefaultDH() {
-		// Defined in meters
-		dh_.a[0] = 0.070f;
-		dh_.a[1] = 0.360f;
-		dh_.a[2] = 0;
-		dh_.a[3] = 0;
-		dh_.a[4] = 0;
-		dh_.a[5] = 0;
-		dh_.alpha[0] = -Pi / 2;
-		dh_.alpha[1] = 0;
-		dh_.alpha[2] = Pi / 2;
-		dh_.alpha[3] = Pi / 2;
-		dh_.alpha[4] = Pi / 2;
-		dh_.alpha[5] = 0;
-		dh_.d[0] = 0.352f;
-		dh_.d[1] = 0;
-		dh_.d[2] = 0;
-		dh_.d[3] = 0.380f;
-		dh_.d[4] = 0;
-		dh_.d[5] = 0.065f;
+	void RobotGraphics::drawLinkMeshes(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames) const {
+		auto color = sdl::Color::createU32(230, 100, 40);
+		for (size_t i = 0; i < frames.size(); ++i) {
+			graphic.pushMatrix();
+			graphic.multiplyMatrix(frames[i]);
+			graphic.addMesh(*linkMeshes_->getMesh(i), color);
+			graphic.popMatrix();
+		}
+	}
+
+	void RobotGraphics::drawLinks(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames, bool skinned) const {
+		std::array<glm::vec3, 7> positions;
+		for (size_t i = 0; i < frames.size(); ++i) {
+			positions[i] = frames[i][3];
+		}
+
+		// Each part is rigid in the frame of the distal end of the link, i.e. the origin of
+		// frame n-1 is constant in frame n. In skinned mode the part is recorded relative
+		// to that frame and the vertex shader moves it with the frame.
+		auto beginLink = [&](int frame) {
+			graphic.pushMatrix();
+			if (skinned) {
+				graphic.setStaticTransformIndex(frame);
+				graphic.multiplyMatrix(glm::inverse(frames[frame]));
+			}
+		};
+
+		auto color = sdl::Color::createU32(230, 100, 40);
+
+		beginLink(0); // Bas-klumpen som roboten sitter på
+		graphic.scale(glm::vec3{1.0f, 0.8f, 0.3f});
+		graphic.translate(glm::vec3{0.0f, 0.0f, 0.15f});
+		graphic.addSolidCube(0.3f, color);
+		graphic.popMatrix();
+
+		beginLink(1);
+		drawCylinderLink(graphic, positions[0], positions[1], 0.05f, 0.05f, color);
+		graphic.translate(glm::vec3{0.0f, 0.0f, 0.05f});
+		graphic.addSolidSphere(0.05f * 1.8f, color);
+		graphic.popMatrix();
+
+		beginLink(2);
+		drawCylinderLink(graphic, positions[1], positions[2], 0.05f, 0.03f, color);
+		graphic.addSolidSphere(0.05f * 1.4f, color);
+		graphic.popMatrix();
+
+		// The origin of frame 5 is the wrist center, the same point as the origin of frame 4.
+		beginLink(4);
+		drawCylinderLink(graphic, positions[3], positions[5], 0.03f, 0.02f, color);
+		graphic.addSolidSphere(0.03f * 1.4f, color);
+		graphic.popMatrix();
+
+		beginLink(6);
+		drawCylinderLink(graphic, positions[5], positions[6], 0.02f, 0.01f, color);
+		graphic.addSolidSphere(0.02f * 1.4f, color);
+		graphic.popMatrix();
+
+		beginLink(6);
+		graphic.translate(positions[6]);
+		graphic.addSolidSphere(0.01f * 1.1f, color);
+		graphic.popMatrix();
+	}
+
+	void RobotGraphics::drawImpostorLinks(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames) const {
+		std::array<glm::vec3, 7> positions;
+		for (size_t i = 0; i < frames.size(); ++i) {
+			positions[i] = frames[i][3];
+		}
+
+		auto color = sdl::Color::createU32(230, 100, 40);
+
+		graphic.pushMatrix(); // Bas-klumpen som roboten sitter på
+		graphic.scale(glm::vec3{1.0f, 0.8f, 0.3f});
+		graphic.translate(glm::vec3{0.0f, 0.0f, 0.15f});
+		graphic.addSolidCube(0.3f, color);
+		graphic.popMatrix();
+
+		// The sphere of link 1 is 0.05 along the link, as in drawLinks.
+		const glm::vec3 direction = glm::normalize(positions[1] - positions[0]);
+		graphic.addCapsuleImpostor(positions[0], positions[1], 0.05f, color);
+		graphic.addSphereImpostor(positions[0] + 0.05f * direction, 0.05f * 1.8f, color);
+
+		graphic.addCapsuleImpostor(positions[1], positions[2], 0.5f * (0.05f + 0.03f), color);
+		graphic.addSphereImpostor(positions[1], 0.05f * 1.4f, color);
+
+		graphic.addCapsuleImpostor(positions[3], positions[5], 0.5f * (0.03f + 0.02f), color);
+		graphic.addSphereImpostor(positions[3], 0.03f * 1.4f, color);
+
+		graphic.addCapsuleImpostor(positions[5], positions[6], 0.5f * (0.02f + 0.01f), color);
+		graphic.addSphereImpostor(positions[5], 0.02f * 1.4f, color);
+
+		graphic.addSphereImpostor(positions[6], 0.01f * 1.1f, color);
 	}
 
 	glm::mat4 RobotGraphics::rotateZ(const glm::vec3& p1, const glm::vec3& p2) const {
@@ -221,12 +272,12 @@ namespace robot {
 	}
 
 	
-	void RobotGraphics::drawCylinderLink(Graphic& graphic, const glm::vec3& pos1, const glm::vec3& pos2, float radie1, float radie2, sdl::Color color) const {
+	void RobotGraphics::drawCylinderLink(GeometryBuilder& graphic, const glm::vec3& pos1, const glm::vec3& pos2, float radie1, float radie2, sdl::Color color) const {
 		graphic.translate(pos1);
 		auto matrix = rotateZ(pos1, pos2);
 		graphic.multiplyMatrix(matrix);
 		float length = glm::length(pos2 - pos1);
-		graphic.addCylinder(radie1, radie2, length, 10, 10, color);
+		graphic.addCylinder(radie1, radie2, length, color);
 	}
 
 }
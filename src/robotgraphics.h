@@ -2,35 +2,63 @@
 #define ROBOT_ROBOTGRAPHICS_H
 
 #include "graphic.h"
+#include "meshstreamer.h"
+#include "robotkinematics.h"
 
 #include <glm/mat4x4.hpp>
 #include <glm/vec4.hpp>
 
 #include <array>
+#include <vector>
 
 namespace robot {
 
-	/// A struct containing the DH-parameters for a robot with 6 degree of freedom.
-	struct RobotDHPar {
-		float a[6];
-		float alpha[6];
-		float d[6];
-	};
-
 	class RobotGraphics {
 	public:
-		/// Loads the DH-parameters used in the graphic functions.
-		RobotGraphics();
+		RobotGraphics() = default;
 
 		/// Draws the robot, baseframe and TCP-frame
-		void draw(Graphic& graphic, const std::array<float, 6>& angles, int viewportWidth, int viewportHeight);
+		void draw(GeometryBuilder& graphic, const std::array<float, 6>& angles);
+
+		/// In skinning mode the robot mesh is uploaded once and each vertex follows the
+		/// frame of its link in the vertex shader, only the 7 frames are sent each frame.
+		void setSkinning(bool skinning);
+
+		bool isSkinning() const {
+			return skinning_;
+		}
+
+		/// Draws the joints as ray-cast sphere impostors and the links as capsule impostors,
+		/// smooth at any distance. Takes precedence over the skinning, not over the link meshes.
+		void setImpostors(bool impostors) {
+			impostors_ = impostors;
+		}
+
+		bool isImpostors() const {
+			return impostors_;
+		}
+
+		/// Draws the TCP positions of random joint configurations as sphere impostors, colored
+		/// by the height. The configurations are sampled on the first call.
+		void drawReachableTcps(GeometryBuilder& graphic);
+
+		/// Meshes for the base (index 0) and the six links, each in the coordinates of its
+		/// joint frame. Used instead of the primitives when all are loaded.
+		void setLinkMeshes(const MeshStreamer* linkMeshes) {
+			linkMeshes_ = linkMeshes;
+		}
+
+		bool hasLinkMeshes() const {
+			return linkMeshes_ != nullptr && linkMeshes_->isLoaded();
+		}
 
 		/// Draws the frame defined by the homogenous transformation
 		/// from the base frame to the frame to be drawed.
-		void drawFrame(Graphic& graphic, const glm::mat4& h, float size, int viewportWidth, int viewportHeight) const;
+		void drawFrame(GeometryBuilder& graphic, const glm::mat4& h, float size) const;
 
-		/// Draws a white box representing the current workspace.
-		void drawWorkspace(Graphic& graphic, int viewPortWidht, int viewPortHeight) const;
+		/// Draws a white box representing the current workspace. The box is kept in
+		/// GPU memory and only recorded again after setWorkspace.
+		void drawWorkspace(GeometryBuilder& graphic);
 
 		/// Sets the current workspace.
 		void setWorkspace(float xMin, float yMin, float zMin,
@@ -45,21 +73,38 @@ namespace robot {
 			return jointPositions_;
 		}
 
+		/// Returns the joint frames from the last draw call, index 0 is the base frame
+		/// and index 6 is the TCP-frame.
+		const std::array<glm::mat4, 7>& getJointFrames() const {
+			return kinematicsCache_.getFrames();
+		}
+
+		const RobotKinematics& getKinematics() const {
+			return kinematicsCache_.getKinematics();
+		}
+
 	private:
 		std::array<glm::vec4, 7> jointPositions_;
-		RobotDHPar dh_;
+		KinematicsCache kinematicsCache_;
 		std::array<glm::vec4, 8> workspacePositions_;
+		StaticGeometry workspace_{SDL_GPU_PRIMITIVETYPE_LINELIST, VertexFlag::NoLight};
+		StaticGeometry skinnedMesh_;
+		bool skinning_ = Vertex::HasTransformIndex;
+		bool impostors_ = false;
+		std::vector<glm::vec3> reachableTcps_;
+		float reachableMinZ_ = 0.f;
+		float reachableMaxZ_ = 0.f;
+		const MeshStreamer* linkMeshes_ = nullptr;
+
+		void drawLinkMeshes(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames) const;
 
-		/// Returns the homogenous matrix for transformation from frame n to frame n-1
-		/// where theta is the angle for joint n. It uses the DH-representation
-		/// in calculations.
-		glm::mat4 getH(float theta, int n) const;
+		void drawLinks(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames, bool skinned) const;
 
-		/// Loads the default values for the DH-representation (in meter).
-		void initDefaultDH();
+		/// Same shapes as drawLinks, the tapered links as capsules of the mean radius.
+		void drawImpostorLinks(GeometryBuilder& graphic, const std::array<glm::mat4, 7>& frames) const;
 
 		/// Draws the link for the robot.
-		void drawCylinderLink(Graphic& graphic, const glm::vec3& pos1, const glm::vec3& pos2, float radie1, float radie2, sdl::Color color) const;
+		void drawCylinderLink(GeometryBuilder& graphic, const glm::vec3& pos1, const glm::vec3& pos2, float radie1, float radie2, sdl::Color color) const;
 
 		glm::mat4 rotateZ(const glm::vec3& p1, const glm::vec3& p2) const;
 	};
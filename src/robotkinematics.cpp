@@ -0,0 +1,249 @@
+#include "robotkinematics.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace robot {
+
+	namespace {
+
+		constexpr float Pi = glm::pi<float>();
+
+		// Number of configurations processed together, small enough for a block
+		// of the output arrays to stay in the L1 cache during the whole chain.
+		constexpr size_t BlockSize = 256;
+
+		// Same conversion as convertAngles but for one joint over a range of configurations.
+		void convertAngles(const JointBatch& batch, int joint, size_t offset, size_t count, float* thetas) {
+			const float* angles = batch.angles[joint].data() + offset;
+			switch (joint) {
+				case 1:
+					for (size_t i = 0; i < count; ++i) {
+						thetas[i] = angles[i] - Pi / 2;
+					}
+					break;
+				case 2: {
+					const float* angles1 = batch.angles[1].data() + offset;
+					for (size_t i = 0; i < count; ++i) {
+						thetas[i] = angles[i] + Pi - angles1[i];
+					}
+					break;
+				}
+				case 4:
+					for (size_t i = 0; i < count; ++i) {
+						thetas[i] = (angles[i] + Pi) * (-1);
+					}
+					break;
+				case 5:
+					for (size_t i = 0; i < count; ++i) {
+						thetas[i] = angles[i] - Pi;
+					}
+					break;
+				default:
+					std::copy_n(angles, count, thetas);
+					break;
+			}
+		}
+
+	}
+
+	RobotDHPar createDefaultDH() {
+		RobotDHPar dh;
+		// Defined in meters
+		dh.a[0] = 0.070f;
+		dh.a[1] = 0.360f;
+		dh.a[2] = 0;
+		dh.a[3] = 0;
+		dh.a[4] = 0;
+		dh.a[5] = 0;
+		dh.alpha[0] = -Pi / 2;
+		dh.alpha[1] = 0;
+		dh.alpha[2] = Pi / 2;
+		dh.alpha[3] = Pi / 2;
+		dh.alpha[4] = Pi / 2;
+		dh.alpha[5] = 0;
+		dh.d[0] = 0.352f;
+		dh.d[1] = 0;
+		dh.d[2] = 0;
+		dh.d[3] = 0.380f;
+		dh.d[4] = 0;
+		dh.d[5] = 0.065f;
+		return dh;
+	}
+
+	std::array<float, 6> convertAngles(const std::array<float, 6>& angles) {
+		// Angles[2] is defined relative to the horizontal plane
+		return {
+			angles[0],
+			angles[1] - Pi / 2,
+			angles[2] + Pi - angles[1],
+			angles[3],
+			(angles[4] + Pi) * (-1),
+			angles[5] - Pi
+		};
+	}
+
+	std::array<float, 6> convertThetas(const std::array<float, 6>& thetas) {
+		auto wrap = [](float angle) {
+			return std::remainder(angle, 2 * Pi);
+		};
+		const float angle1 = wrap(thetas[1] + Pi / 2);
+		return {
+			wrap(thetas[0]),
+			angle1,
+			wrap(thetas[2] - Pi + angle1),
+			wrap(thetas[3]),
+			wrap(-thetas[4] - Pi),
+			wrap(thetas[5] + Pi)
+		};
+	}
+
+	void JointBatch::resize(size_t size) {
+		for (auto& joint : angles) {
+			joint.resize(size);
+		}
+	}
+
+	void PoseBatch::resize(size_t size) {
+		for (auto& element : rotation) {
+			element.resize(size);
+		}
+		for (auto& element : position) {
+			element.resize(size);
+		}
+	}
+
+	glm::mat4 PoseBatch::getPose(size_t index) const {
+		return glm::mat4{
+			rotation[0][index], rotation[1][index], rotation[2][index], 0,
+			rotation[3][index], rotation[4][index], rotation[5][index], 0,
+			rotation[6][index], rotation[7][index], rotation[8][index], 0,
+			position[0][index], position[1][index], position[2][index], 1
+		};
+	}
+
+	RobotKinematics::RobotKinematics()
+		: dh_{createDefaultDH()} {
+	}
+
+	RobotKinematics::RobotKinematics(const RobotDHPar& dh)
+		: dh_{dh} {
+	}
+
+	glm::mat4 RobotKinematics::getH(float theta, int n) const {
+		// Using the standard DH-representation.
+		// GLM uses column-major ordering, so we must transpose
+		float ca = std::cos(dh_.alpha[n]);
+		float sa = std::sin(dh_.alpha[n]);
+		float ct = std::cos(theta);
+		float st = std::sin(theta);
+
+		return glm::mat4{
+			 ct,                       st,        0, 0,
+			-st * ca,             ct * ca,       sa, 0,
+			 st * sa,            -ct * sa,       ca, 0,
+			 dh_.a[n] * ct, dh_.a[n] * st, dh_.d[n], 1
+		};
+	}
+
+	std::array<glm::mat4, 7> RobotKinematics::getFrames(const std::array<float, 6>& angles) const {
+		auto thetas = convertAngles(angles);
+
+		std::array<glm::mat4, 7> frames;
+		frames[0] = glm::mat4{1.f};
+		for (int n = 0; n < 6; ++n) {
+			frames[n + 1] = frames[n] * getH(thetas[n], n);
+		}
+		return frames;
+	}
+
+	glm::mat4 RobotKinematics::getTcp(const std::array<float, 6>& angles) const {
+		return getFrames(angles)[6];
+	}
+
+	void RobotKinematics::getTcpBatch(const JointBatch& angles, PoseBatch& poses) const {
+		const size_t size = angles.size();
+		poses.resize(size);
+
+		float thetas[BlockSize];
+		float cosThetas[BlockSize];
+		float sinThetas[BlockSize];
+		for (size_t offset = 0; offset < size; offset += BlockSize) {
+			const size_t count = std::min(BlockSize, size - offset);
+
+			float* x[3] = {poses.rotation[0].data() + offset, poses.rotation[1].data() + offset, poses.rotation[2].data() + offset};
+			float* y[3] = {poses.rotation[3].data() + offset, poses.rotation[4].data() + offset, poses.rotation[5].data() + offset};
+			float* z[3] = {poses.rotation[6].data() + offset, poses.rotation[7].data() + offset, poses.rotation[8].data() + offset};
+			float* p[3] = {poses.position[0].data() + offset, poses.position[1].data() + offset, poses.position[2].data() + offset};
+
+			for (int row = 0; row < 3; ++row) {
+				std::fill_n(x[row], count, row == 0 ? 1.f : 0.f);
+				std::fill_n(y[row], count, row == 1 ? 1.f : 0.f);
+				std::fill_n(z[row], count, row == 2 ? 1.f : 0.f);
+				std::fill_n(p[row], count, 0.f);
+			}
+
+			for (int n = 0; n < 6; ++n) {
+				convertAngles(angles, n, offset, count, thetas);
+				for (size_t i = 0; i < count; ++i) {
+					cosThetas[i] = std::cos(thetas[i]);
+					sinThetas[i] = std::sin(thetas[i]);
+				}
+
+				// Constant for the joint, not for each configuration.
+				const float ca = std::cos(dh_.alpha[n]);
+				const float sa = std::sin(dh_.alpha[n]);
+				const float a = dh_.a[n];
+				const float d = dh_.d[n];
+
+				// Multiply the accumulated frame with getH(theta, n) column by column.
+				for (int row = 0; row < 3; ++row) {
+					float* xr = x[row];
+					float* yr = y[row];
+					float* zr = z[row];
+					float* pr = p[row];
+					for (size_t i = 0; i < count; ++i) {
+						const float ct = cosThetas[i];
+						const float st = sinThetas[i];
+						const float nx = ct * xr[i] + st * yr[i];
+						const float ny = ca * (ct * yr[i] - st * xr[i]) + sa * zr[i];
+						const float nz = sa * (st * xr[i] - ct * yr[i]) + ca * zr[i];
+						pr[i] += a * nx + d * zr[i];
+						xr[i] = nx;
+						yr[i] = ny;
+						zr[i] = nz;
+					}
+				}
+			}
+		}
+	}
+
+	KinematicsCache::KinematicsCache(const RobotKinematics& kinematics)
+		: kinematics_{kinematics} {
+	}
+
+	int KinematicsCache::update(const std::array<float, 6>& angles) {
+		// Compare in DH-representation, since joint 3 depends on both angles[1] and angles[2].
+		auto thetas = convertAngles(angles);
+
+		int first = 0;
+		if (valid_) {
+			while (first < 6 && thetas[first] == thetas_[first]) {
+				++first;
+			}
+		} else {
+			frames_[0] = glm::mat4{1.f};
+			valid_ = true;
+		}
+
+		for (int n = first; n < 6; ++n) {
+			thetas_[n] = thetas[n];
+			localFrames_[n] = kinematics_.getH(thetas[n], n);
+			frames_[n + 1] = frames_[n] * localFrames_[n];
+		}
+		return first;
+	}
+
+}
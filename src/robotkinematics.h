@@ -0,0 +1,135 @@
+#ifndef ROBOT_ROBOTKINEMATICS_H
+#define ROBOT_ROBOTKINEMATICS_H
+
+#include <glm/mat4x4.hpp>
+
+#include <array>
+#include <vector>
+
+namespace robot {
+
+	/// A struct containing the DH-parameters for a robot with 6 degree of freedom.
+	struct RobotDHPar {
+		float a[6];
+		float alpha[6];
+		float d[6];
+	};
+
+	/// Returns the default values for the DH-representation (in meter) of the ABB IRB-140.
+	RobotDHPar createDefaultDH();
+
+	/// Converts the joint angles for the C-code for the robot to angles
+	/// suited for the DH-representation (and the real robot).
+	std::array<float, 6> convertAngles(const std::array<float, 6>& angles);
+
+	/// The inverse of convertAngles, the resulting angles are in the range [-Pi, Pi].
+	std::array<float, 6> convertThetas(const std::array<float, 6>& thetas);
+
+	/// Joint angles for many robot configurations in structure-of-arrays layout,
+	/// i.e. angles[joint][configuration]. Same angle convention as convertAngles.
+	struct JointBatch {
+		std::array<std::vector<float>, 6> angles;
+
+		void resize(size_t size);
+
+		size_t size() const {
+			return angles[0].size();
+		}
+	};
+
+	/// Homogenous transformations in structure-of-arrays layout. The rotation
+	/// is stored column-major as in glm, i.e. rotation[column * 3 + row][pose].
+	struct PoseBatch {
+		std::array<std::vector<float>, 9> rotation;
+		std::array<std::vector<float>, 3> position;
+
+		void resize(size_t size);
+
+		size_t size() const {
+			return position[0].size();
+		}
+
+		glm::mat4 getPose(size_t index) const;
+	};
+
+	/// Forward kinematics for a 6 degree of freedom robot using the DH-representation.
+	/// Has no dependency on the graphics and can be used headless.
+	class RobotKinematics {
+	public:
+		/// Uses the default DH-parameters.
+		RobotKinematics();
+
+		explicit RobotKinematics(const RobotDHPar& dh);
+
+		/// Returns the homogenous matrix for transformation from frame n to frame n-1
+		/// where theta is the angle for joint n. It uses the DH-representation
+		/// in calculations.
+		glm::mat4 getH(float theta, int n) const;
+
+		/// Returns the homogenous transformations from each joint frame to the base frame.
+		/// Index 0 is the base frame and index 6 is the TCP-frame.
+		std::array<glm::mat4, 7> getFrames(const std::array<float, 6>& angles) const;
+
+		/// Returns the homogenous transformation from the TCP-frame to the base frame.
+		glm::mat4 getTcp(const std::array<float, 6>& angles) const;
+
+		/// Evaluates the TCP-frame for all joint configurations in angles. The inner
+		/// loops run over configurations on contiguous arrays in order to be vectorized.
+		void getTcpBatch(const JointBatch& angles, PoseBatch& poses) const;
+
+		const RobotDHPar& getDH() const {
+			return dh_;
+		}
+
+	private:
+		RobotDHPar dh_;
+	};
+
+	/// Forward kinematics which keeps the transformations from the last call.
+	/// Only the part of the chain after the first changed joint is recomputed,
+	/// which is the common case when jogging the distal joints.
+	class KinematicsCache {
+	public:
+		KinematicsCache() = default;
+
+		explicit KinematicsCache(const RobotKinematics& kinematics);
+
+		/// Updates the cached frames for the joint angles and returns the index of
+		/// the first recomputed joint, i.e. 6 if nothing changed.
+		int update(const std::array<float, 6>& angles);
+
+		/// Marks all cached frames as outdated.
+		void invalidate() {
+			valid_ = false;
+		}
+
+		/// Returns the homogenous transformations from each joint frame to the base frame.
+		/// Index 0 is the base frame and index 6 is the TCP-frame.
+		const std::array<glm::mat4, 7>& getFrames() const {
+			return frames_;
+		}
+
+		/// Returns the transformations from frame n to frame n-1, i.e. the getH results.
+		const std::array<glm::mat4, 6>& getLocalFrames() const {
+			return localFrames_;
+		}
+
+		const glm::mat4& getTcp() const {
+			return frames_[6];
+		}
+
+		const RobotKinematics& getKinematics() const {
+			return kinematics_;
+		}
+
+	private:
+		RobotKinematics kinematics_;
+		std::array<float, 6> thetas_{};
+		std::array<glm::mat4, 6> localFrames_;
+		std::array<glm::mat4, 7> frames_;
+		bool valid_ = false;
+	};
+
+}
+
+#endif
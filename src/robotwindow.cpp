@@ -1,10 +1,15 @@
 #include "robotwindow.h"
+#include "meshimport.h"
 
 #include <imgui.h>
 #include <spdlog/spdlog.h>
 
 #include <sdl/gpuutil.h>
 
+#include <filesystem>
+#include <format>
+#include <vector>
+
 namespace robot {
 
 	namespace {
@@ -77,9 +82,69 @@ namespace robot {
 
 	void RobotWindow::preLoop() {
 		setupPipeline();
+
+		// The CAD models are optional, the primitives are drawn until all are loaded and
+		// without a message if there are none.
+		std::vector<std::filesystem::path> linkMeshes;
+		for (int i = 0; i <= 6; ++i) {
+			if (auto source = findMeshSource(std::format("irb140/link{}", i)); !source.empty()) {
+				linkMeshes.push_back(std::move(source));
+			}
+		}
+		if (linkMeshes.size() == 7) {
+			linkMeshes_.start(gpuDevice_, std::move(linkMeshes));
+			robot_.setLinkMeshes(&linkMeshes_);
+		} else if (!linkMeshes.empty()) {
+			spdlog::warn("[RobotWindow] Found {} of the 7 link meshes in irb140, drawing primitives", linkMeshes.size());
+		}
+
+		// The robot in one job, the floor and the lights in the other.
+		for (auto& frame : frames_) {
+			for (int i = 0; i < 2; ++i) {
+				frame.builders.push_back(graphic_.createBuilder(frame.camera));
+			}
+		}
+
+		std::array<float, 6> angles;
+		for (size_t i = 0; i < angles_.size(); ++i) {
+			angles[i] = glm::radians(angles_[i]);
+		}
+		controlThread_.start(angles);
+	}
+
+	void RobotWindow::setJointAngles() {
+		std::array<float, 6> angles;
+		for (size_t i = 0; i < angles_.size(); ++i) {
+			angles[i] = glm::radians(angles_[i]);
+		}
+		controlThread_.setAngles(angles);
+	}
+
+	void RobotWindow::updateJogTwist(const Twist& buttonTwist) {
+		const bool* keys = SDL_GetKeyboardState(nullptr);
+		auto axis = [&](SDL_Scancode positive, SDL_Scancode negative) {
+			return (keys[positive] ? 1.f : 0.f) - (keys[negative] ? 1.f : 0.f);
+		};
+		glm::vec3 direction{
+			axis(SDL_SCANCODE_I, SDL_SCANCODE_K),
+			axis(SDL_SCANCODE_J, SDL_SCANCODE_L),
+			axis(SDL_SCANCODE_U, SDL_SCANCODE_O)
+		};
+
+		Twist twist = buttonTwist;
+		if (keys[SDL_SCANCODE_LSHIFT] || keys[SDL_SCANCODE_RSHIFT]) {
+			twist.angular += direction;
+		} else {
+			twist.linear += direction;
+		}
+		twist.linear *= jogLinearSpeed_;
+		twist.angular *= jogAngularSpeed_;
+		controlThread_.setTwist(twist, jogFrame_);
 	}
 
 	void RobotWindow::setupPipeline() {
+		// The frame worker may be drawing the robot.
+		frameWorker_.wait();
 		graphic_.preLoop(gpuDevice_, gpuSampleCount_);
 		robot_.setWorkspace(-100, -100, -100, 100, 100, 100, glm::mat4{1});
 
@@ -111,22 +176,72 @@ namespace robot {
 
 			static std::array<char, 64> buffer;
 
+			// The control thread owns the joint angles.
+			const auto& angles = controlThread_.getState().angles;
+			for (size_t i = 0; i < angles_.size(); ++i) {
+				angles_[i] = glm::degrees(angles[i]);
+			}
+
+			bool anglesChanged = false;
 			for (size_t i = 0; i < angles_.size(); ++i) {
 				char label[16];
 				std::snprintf(label, sizeof(label), "Joint %d", (int) i + 1);
-				ImGui::SliderFloat(
+				anglesChanged |= ImGui::SliderFloat(
 					label,
 					&angles_[i],
 					-180.f,
 					180.f
 				);
 			}
+			if (anglesChanged) {
+				setJointAngles();
+			}
+			ImGui::End();
+
+			ImGui::Begin("Cartesian Jog");
+			ImGui::Text("Hold I/K, J/L, U/O to jog along x, y, z");
+			ImGui::Text("Hold Shift to rotate around the axes instead");
+			std::array frames = {"Base", "Tool"};
+			int frame = static_cast<int>(jogFrame_);
+			if (ImGui::Combo("Frame", &frame, frames.data(), static_cast<int>(frames.size()))) {
+				jogFrame_ = static_cast<JogFrame>(frame);
+			}
+			ImGui::SliderFloat("Linear Speed (m/s)", &jogLinearSpeed_, 0.001f, 0.5f, "%.3f", ImGuiSliderFlags_Logarithmic);
+			ImGui::SliderFloat("Angular Speed (rad/s)", &jogAngularSpeed_, 0.005f, 2.f, "%.3f", ImGuiSliderFlags_Logarithmic);
+
+			Twist buttonTwist;
+			std::array axes = {"X", "Y", "Z", "Rx", "Ry", "Rz"};
+			for (int i = 0; i < 6; ++i) {
+				glm::vec3& twist = i < 3 ? buttonTwist.linear : buttonTwist.angular;
+				for (float sign : {-1.f, 1.f}) {
+					char label[16];
+					std::snprintf(label, sizeof(label), "%s%s", sign < 0 ? "-" : "+", axes[i]);
+					ImGui::Button(label, ImVec2{40, 0});
+					if (ImGui::IsItemActive()) {
+						twist[i % 3] += sign;
+					}
+					ImGui::SameLine();
+				}
+				if (i == 2 || i == 5) {
+					ImGui::NewLine();
+				}
+			}
+			updateJogTwist(buttonTwist);
+			ImGui::End();
+
+			const auto& statistics = controlThread_.getState().statistics;
+			ImGui::Begin("Control Loop");
+			ImGui::Text("Period: %.0f us", std::chrono::duration<double, std::micro>(controlThread_.getPeriod()).count());
+			ImGui::Text("Mean: %.1f us", statistics.meanPeriod);
+			ImGui::Text("Min/Max: %.1f/%.1f us", statistics.minPeriod, statistics.maxPeriod);
+			ImGui::Text("Jitter (std dev): %.1f us", statistics.jitter);
+			ImGui::Text("Max lateness: %.1f us", statistics.maxLateness);
+			ImGui::Text("Overruns: %llu", static_cast<unsigned long long>(statistics.overruns));
 			ImGui::End();
 
-			const auto& jointPositions = robot_.getJointPositions();
 			ImGui::Begin("Joint Positions");
-			for (size_t i = 0; i < jointPositions.size(); ++i) {
-				const auto& pos = jointPositions[i];
+			for (size_t i = 0; i < jointPositions_.size(); ++i) {
+				const auto& pos = jointPositions_[i];
 				ImGui::Text(
 					"Joint %d: (%.2f, %.2f, %.2f)",
 					static_cast<int>(i + 1),
@@ -159,6 +274,18 @@ namespace robot {
 					ImGui::SameLine();
 				}
 			}
+			if (ImGui::Button("Add Light")) {
+				lightingData_.lights.push_back(Light{
+					.position = glm::vec3{0.f, 0.f, 2.f},
+					.color = sdl::color::White,
+					.radius = 2.f,
+					.ambientStrength = 0.f,
+					.shininess = 30.f,
+					.enabled = true
+				});
+			}
+			const auto& lightClusters = graphic_.getLightClusters();
+			ImGui::Text("Light assignments: %zu, at most %u per cluster", lightClusters.getLightIndices().size(), lightClusters.getMaxCount());
 			ImGui::SeparatorText("Light");
 			if (light < lightingData_.lights.size()) {
 				ImGui::Checkbox("Display Light Bulb", &lightingData_.lights[light].enabled);
@@ -170,6 +297,40 @@ namespace robot {
 				ImGui::SliderFloat("Shininess", &lightingData_.lights[light].shininess, 1.f, 128.f);
 			}
 
+			ImGui::SeparatorText("Robot");
+			// Not set on the robot here, the frame worker may be drawing it.
+			ImGui::Checkbox("Rigid Skinning", &skinning_);
+			ImGui::Checkbox("Impostors (ray-cast spheres and capsules)", &impostors_);
+			ImGui::Checkbox("Reachable TCPs", &reachableTcps_);
+
+			ImGui::SeparatorText("Floor");
+			ImGui::Checkbox("Procedural Floor", &proceduralFloor_);
+			if (proceduralFloor_) {
+				ImGui::SliderFloat("Fade Distance (m)", &proceduralFloorStyle_.fadeDistance, 5.f, 200.f, "%.0f", ImGuiSliderFlags_Logarithmic);
+				ImGui::SliderFloat("Grid Line Width (px)", &proceduralFloorStyle_.lineWidth, 0.5f, 4.f, "%.1f");
+			}
+
+			ImGui::SeparatorText("Culling");
+			if (bool culling = graphic_.isCulling(); ImGui::Checkbox("Frustum Culling", &culling)) {
+				graphic_.setCulling(culling);
+			}
+			ImGui::Text("Culled instances: %zu", graphic_.getCulledInstances());
+
+			ImGui::SeparatorText("Memory");
+			ImGui::Text("Heap allocations per frame: %zu (%zu bytes)", frameAllocations_.count, frameAllocations_.bytes);
+
+			ImGui::SeparatorText("Frame");
+			ImGui::SliderInt("Frames Built Ahead", &pipelineDepth_, 0, MaxPipelineDepth);
+			ImGui::Text("Input latency: %.1f ms", latencyMs_);
+			ImGui::Text("Frame: %.2f ms, build: %.2f ms", frameMs_, buildMs_);
+
+			ImGui::SeparatorText("Uploads");
+			const auto& uploadStats = graphic_.getUploadStats();
+			ImGui::Text("Uploaded: %zu KiB per frame", uploadStats.uploadedBytes / 1024);
+			ImGui::Text("Ring: %zu/%zu KiB (peak %zu KiB)", uploadStats.used / 1024, uploadStats.capacity / 1024, uploadStats.peakUsed / 1024);
+			ImGui::Text("Frames in flight: %zu/%zu", uploadStats.framesInFlight, UploadRing::FramesInFlight);
+			ImGui::Text("Stalls: %zu", uploadStats.stalls);
+
 			ImGui::SeparatorText("Anti-Aliasing");
 			std::array items = {"SDL_GPU_SAMPLECOUNT_1", "SDL_GPU_SAMPLECOUNT_2", "SDL_GPU_SAMPLECOUNT_4", "SDL_GPU_SAMPLECOUNT_8"};
 			static int item = static_cast<int>(gpuSampleCount_);
@@ -184,36 +345,53 @@ namespace robot {
 	}
 
 	void RobotWindow::renderFrame(const sdl::DeltaTime& deltaTime, SDL_GPUTexture* swapchainTexture, SDL_GPUCommandBuffer* commandBuffer) {
-		camera_.update(deltaTime, view_);
+		AllocationScope allocations;
+		// Started at the end of the last call, it overlapped the submit, the present, the
+		// events and ImGui.
+		frameWorker_.wait();
+
+		const auto frameStart = std::chrono::steady_clock::now();
+		if (frameStart_ != std::chrono::steady_clock::time_point{}) {
+			const std::chrono::duration<float, std::milli> frameTime = frameStart - frameStart_;
+			frameMs_ += 0.05f * (frameTime.count() - frameMs_);
+		}
+		frameStart_ = frameStart;
 
-		graphic_.clear();
-		graphic_.loadIdentityMatrix();
+		camera_.update(deltaTime, view_);
 
-		std::array<float, 6> anglesInRad_;
-		for (size_t i = 0; i < angles_.size(); ++i) {
-			anglesInRad_[i] = glm::radians(angles_[i]);
-		}
 		int w, h;
 		SDL_GetWindowSize(window_, &w, &h);
 
-		robot_.draw(graphic_, anglesInRad_, w, h);
-		drawFloor();
-		for (auto& light : lightingData_.lights) {
-			if (light.enabled) {
-				graphic_.loadIdentityMatrix();
-				graphic_.translate(light.position);
-				graphic_.addSolidSphere(0.1f, 10, 10, light.color, DrawMode::NoLight);
+		if (pipelineDepth_ != activeDepth_) {
+			for (auto& frame : frames_) {
+				frame.built = false;
 			}
+			frameIndex_ = 0;
+			activeDepth_ = pipelineDepth_;
 		}
-		graphic_.loadIdentityMatrix();
 
-		robot_.drawWorkspace(graphic_, w, h);
-		//graphic_.addLine({0.f, 0.f, 0.f}, {0.f, 0.f, 3.f}, 3.f, sdl::color::Red, w, h);
-		//graphic_.addLine({1.f, 0.f, 0.f}, {1.f, 0.f, 3.f}, 1.f, sdl::color::Red, w, h);
-		//graphic_.addLine({0.f, 0.f, 0.5f}, {1.f, 0.f, 0.5f}, 1.f, sdl::color::Red, w, h);
+		// Pipelined, the frame was built ahead from older inputs, else it is built here.
+		FrameState& frame = frames_[frameIndex_];
+		if (!frame.built) {
+			readInputs(frame, w, h);
+			buildFrame(frame);
+		}
+		jointPositions_ = frame.jointPositions;
 
-		graphic_.gpuCopyPass(gpuDevice_, commandBuffer);
-		reshape(commandBuffer, w, h);
+		graphic_.clear();
+		graphic_.setCamera(frame.camera);
+		for (auto& builder : frame.builders) {
+			graphic_.submit(builder);
+		}
+		robot_.drawWorkspace(graphic_);
+		if (frame.proceduralFloor) {
+			graphic_.addFloor(proceduralFloorStyle_);
+		}
+
+		graphic_.setLighting(frame.lightingData);
+		graphic_.gpuCopyPass(gpuDevice_);
+		graphic_.uploadLightingData(commandBuffer);
+		graphic_.uploadProjectionMatrix(commandBuffer);
 
 		SDL_GPUDepthStencilTargetInfo depthTargetInfo{
 			.texture = depthTexture_.get(),
@@ -247,7 +425,7 @@ namespace robot {
 		};
 		SDL_SetGPUViewport(renderPass, &viewPort);
 
-		graphic_.bindAndDraw(gpuDevice_, renderPass);
+		graphic_.bindAndDraw(gpuDevice_, commandBuffer, renderPass);
 
 		SDL_EndGPURenderPass(renderPass);
 
@@ -272,36 +450,123 @@ namespace robot {
 		};
 
 		SDL_BlitGPUTexture(commandBuffer, &blitInfo);
+
+		const std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - frame.inputTime;
+		latencyMs_ += 0.05f * (latency.count() - latencyMs_);
+		buildMs_ += 0.05f * (frame.buildMs - buildMs_);
+		frame.built = false;
+		// Before the worker starts, the count is of all threads.
+		frameAllocations_ = allocations.get();
+
+		// Fills the frames ahead, the last one on the frame worker from the inputs of now.
+		// Synchronously only when the pipeline is filled, e.g. after the depth changed.
+		if (activeDepth_ > 0) {
+			const size_t frameCount = activeDepth_ + 1;
+			frameIndex_ = (frameIndex_ + 1) % frameCount;
+			for (int ahead = 0; ahead < activeDepth_; ++ahead) {
+				FrameState& next = frames_[(frameIndex_ + ahead) % frameCount];
+				if (next.built) {
+					continue;
+				}
+				readInputs(next, w, h);
+				if (ahead + 1 < activeDepth_) {
+					buildFrame(next);
+				} else {
+					nextFrame_ = &next;
+					frameWorker_.start();
+				}
+			}
+		}
+	}
+
+	void RobotWindow::readInputs(FrameState& frame, int width, int height) {
+		frame.inputTime = std::chrono::steady_clock::now();
+		frame.width = width;
+		frame.height = height;
+		frame.eye = camera_.getEye();
+		frame.culling = graphic_.isCulling();
+		frame.angles = controlThread_.getState().angles;
+		frame.lightingData = lightingData_;
+		frame.proceduralFloor = proceduralFloor_;
+		frame.impostors = impostors_;
+		frame.skinning = skinning_;
+		frame.reachableTcps = reachableTcps_;
+	}
+
+	void RobotWindow::buildFrame(FrameState& frame) {
+		const auto start = std::chrono::steady_clock::now();
+		// The camera is needed when building the geometry, e.g. for the level of detail.
+		reshape(frame);
+
+		// Independent parts of the scene, each built into its own builder.
+		jobs_.parallelFor(frame.builders.size(), [&](size_t job) {
+			GeometryBuilder& builder = frame.builders[job];
+			builder.clear();
+			if (job == 0) {
+				robot_.setImpostors(frame.impostors);
+				robot_.setSkinning(frame.skinning);
+				robot_.draw(builder, frame.angles);
+				frame.jointPositions = robot_.getJointPositions();
+				if (frame.reachableTcps) {
+					robot_.drawReachableTcps(builder);
+				}
+			} else {
+				if (!frame.proceduralFloor) {
+					drawFloor(builder);
+				}
+				drawLights(builder, frame.lightingData, frame.impostors);
+			}
+		});
+		const std::chrono::duration<float, std::milli> buildTime = std::chrono::steady_clock::now() - start;
+		frame.buildMs = buildTime.count();
+		frame.built = true;
 	}
 
-	void RobotWindow::reshape(SDL_GPUCommandBuffer* commandBuffer, int width, int height) {
+	void RobotWindow::reshape(FrameState& frame) {
 		static constexpr float kFovY = 40;
 
 		// Compute the viewing parameters based on a fixed fov and viewing
 		// a canonical box centered at the origin
 		static const float nearDist = 0.5f * 0.1f / std::tan(glm::radians(kFovY) / 2.f);
 		static const float farDist = nearDist + 100.f;
-		const float aspect = static_cast<float>(width) / height;
+		const float aspect = static_cast<float>(frame.width) / frame.height;
 		auto projection = glm::perspective(glm::radians(kFovY), aspect, nearDist, farDist);
 
 		glm::vec3 center{0.0f, 0.0f, 0.7f};
 		glm::vec3 up{0.0f, 0.0f, 1.0f};
-		glm::vec3 eye = camera_.getEye();
-		glm::mat4 viewMatrix = glm::lookAt(eye, center, up);
-		lightingData_.cameraPos = eye;
-		graphic_.uploadLightingData(commandBuffer, lightingData_);
-		graphic_.uploadProjectionMatrix(commandBuffer, projection, viewMatrix);
+		glm::mat4 viewMatrix = glm::lookAt(frame.eye, center, up);
+		frame.lightingData.cameraPos = frame.eye;
+		frame.camera = FrameCamera::create(projection, viewMatrix, frame.width, frame.height, frame.culling);
 	}
 
-	void RobotWindow::drawFloor() {
-		const float floorSize = 5.f;
-		const float step = 0.5f;
-		sdl::Color color1 = sdl::color::html::LightGray;
-		sdl::Color color2 = sdl::color::html::Gray;
-		for (float x = -floorSize; x < floorSize; x += step) {
-			for (float y = -floorSize; y < floorSize; y += step) {
-				sdl::Color color = (((int)((x + floorSize) / step) + (int)((y + floorSize) / step)) % 2 == 0) ? color1 : color2;
-				graphic_.addRectangle({x, y}, {step, step}, color);
+	void RobotWindow::drawFloor(GeometryBuilder& builder) {
+		if (floor_.isDirty()) {
+			const float floorSize = 5.f;
+			const float step = 0.5f;
+			sdl::Color color1 = sdl::color::html::LightGray;
+			sdl::Color color2 = sdl::color::html::Gray;
+			builder.beginStatic(floor_);
+			for (float x = -floorSize; x < floorSize; x += step) {
+				for (float y = -floorSize; y < floorSize; y += step) {
+					sdl::Color color = (((int)((x + floorSize) / step) + (int)((y + floorSize) / step)) % 2 == 0) ? color1 : color2;
+					builder.addRectangle({x, y}, {step, step}, color);
+				}
+			}
+			builder.endStatic();
+		}
+		builder.drawStatic(floor_);
+	}
+
+	void RobotWindow::drawLights(GeometryBuilder& builder, const LightingData& lightingData, bool impostors) {
+		for (const auto& light : lightingData.lights) {
+			if (light.enabled) {
+				builder.loadIdentityMatrix();
+				builder.translate(light.position);
+				if (impostors) {
+					builder.addSphereImpostor(glm::vec3{0.f}, 0.1f, light.color, DrawMode::NoLight);
+				} else {
+					builder.addSolidSphere(0.1f, light.color, DrawMode::NoLight);
+				}
 			}
 		}
 	}
@@ -330,7 +595,8 @@ namespace robot {
 			case SDL_EVENT_QUIT:
 				sdl::Window::quit();
 				break;
-			case SDL_EVENT_KEY_DOWN:
+			case SDL_EVENT_KEY_DOWN: {
+				const auto anglesBefore = angles_;
 				switch (windowEvent.key.key) {
 					case SDLK_ESCAPE:
 						sdl::Window::quit();
@@ -391,7 +657,11 @@ namespace robot {
 						angles_[5] -= 5.f;
 						break;
 				}
+				if (angles_ != anglesBefore) {
+					setJointAngles();
+				}
 				break;
+			}
 		}
 	}
 
@@ -1,14 +1,21 @@
 #ifndef TESTIMGUIWINDOW_H
 #define TESTIMGUIWINDOW_H
 
+#include "allocationcounter.h"
 #include "graphic.h"
 #include "sphereviewvar.h"
 #include "robotgraphics.h"
 #include "camera.h"
+#include "controlthread.h"
+#include "frameworker.h"
+#include "jobsystem.h"
+#include "meshstreamer.h"
 #include "shader.h"
 
 #include <sdl/window.h>
 
+#include <chrono>
+
 namespace robot {
 
 	class RobotWindow : public sdl::Window {
@@ -24,13 +31,76 @@ namespace robot {
 
 		void renderFrame(const sdl::DeltaTime& deltaTime, SDL_GPUTexture* swapchainTexture, SDL_GPUCommandBuffer* commandBuffer) override;
 
-		void reshape(SDL_GPUCommandBuffer* commandBuffer, int width, int height);
+		/// Everything building and rendering a frame needs. The inputs are copied in on the
+		/// main thread, so the frame can be built on the frame worker while the events and
+		/// ImGui change the window state. One per frame in the pipeline.
+		struct FrameState {
+			// The inputs, see readInputs.
+			int width = 1;
+			int height = 1;
+			glm::vec3 eye{0.f};
+			bool culling = true;
+			std::array<float, 6> angles{};	// Radians.
+			LightingData lightingData;
+			bool proceduralFloor = false;
+			bool impostors = false;
+			bool skinning = false;
+			bool reachableTcps = false;
+			std::chrono::steady_clock::time_point inputTime;	// When the inputs were read.
+
+			// Built by buildFrame.
+			FrameCamera camera;
+			std::vector<GeometryBuilder> builders;	// One per job.
+			std::array<glm::vec4, 7> jointPositions{};
+			float buildMs = 0.f;
+			bool built = false;
+		};
+
+		/// Copies everything buildFrame reads into the frame, on the main thread.
+		void readInputs(FrameState& frame, int width, int height);
+
+		/// Builds the geometry of the frame from its inputs, on the calling thread or the
+		/// frame worker. Only the frame, the robot and the floor are written.
+		void buildFrame(FrameState& frame);
+
+		/// Updates the camera matrices of the frame for its viewport size.
+		void reshape(FrameState& frame);
+
+		/// The tessellated floor, a 10 x 10 m checkerboard.
+		void drawFloor(GeometryBuilder& builder);
 
-		void drawFloor();
+		/// The light bulbs, as sphere impostors if impostors is set.
+		void drawLights(GeometryBuilder& builder, const LightingData& lightingData, bool impostors);
+
+		/// Sets the jog twist from the held keys and jog buttons.
+		void updateJogTwist(const Twist& buttonTwist);
+
+		void setJointAngles();
 
 		void setupPipeline();
 
 		Graphic graphic_;
+		JobSystem jobs_;
+		static constexpr int MaxPipelineDepth = 2;
+		std::array<FrameState, MaxPipelineDepth + 1> frames_;
+		size_t frameIndex_ = 0;	// The frame rendered next.
+		FrameState* nextFrame_ = nullptr;	// Built by the frame worker.
+		int pipelineDepth_ = 0;	// Frames built ahead of the rendered one, each a frame of latency.
+		int activeDepth_ = 0;	// The depth the frames in the pipeline were built for.
+		float latencyMs_ = 0.f;	// From reading the inputs to the end of renderFrame, smoothed.
+		float frameMs_ = 0.f;	// Between the starts of renderFrame, smoothed.
+		float buildMs_ = 0.f;	// Of buildFrame, smoothed.
+		std::chrono::steady_clock::time_point frameStart_;
+		StaticGeometry floor_;	// The tessellated floor.
+		bool proceduralFloor_ = true;	// Otherwise the tessellated floor.
+		bool impostors_ = false;	// Ray-cast spheres and capsules instead of tessellated ones.
+		bool reachableTcps_ = false;	// Point cloud of sampled TCP positions.
+		bool skinning_ = Vertex::HasTransformIndex;	// Set on the robot by buildFrame.
+		Floor proceduralFloorStyle_{
+			.color1 = sdl::color::html::LightGray,
+			.color2 = sdl::color::html::Gray,
+			.lineColor = sdl::Color{0.3f, 0.3f, 0.3f, 0.5f}
+		};
 		sdl::GpuGraphicsPipeline graphicsPipeline_;
 		sdl::GpuTexture depthTexture_;
 		sdl::GpuTexture renderTexture_;
@@ -39,6 +109,9 @@ namespace robot {
 		SDL_GPUSampleCount gpuSampleCount_ = SDL_GPU_SAMPLECOUNT_4;
 
 		RobotGraphics robot_;
+		MeshStreamer linkMeshes_;
+		AllocationCount frameAllocations_;	// In renderFrame until the frame worker starts, should be zero after the first frames.
+		std::array<glm::vec4, 7> jointPositions_{};	// Of the last rendered frame.
 
 		SphereViewVar view_{
 			.phi = -1.4f,
@@ -47,6 +120,11 @@ namespace robot {
 		};
 		std::array<float, 6> angles_{0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
 
+		ControlThread controlThread_;
+		JogFrame jogFrame_ = JogFrame::Base;
+		float jogLinearSpeed_ = 0.05f;
+		float jogAngularSpeed_ = 0.2f;
+
 		Camera camera_{view_};
 
 		LightingData lightingData_{
@@ -86,6 +164,11 @@ namespace robot {
 				}
 			}
 		};
+
+		// Last, so it is stopped before the state it builds from is destroyed.
+		FrameWorker frameWorker_{[this] {
+			buildFrame(*nextFrame_);
+		}};
 	};
 
 }
@@ -1,28 +1,41 @@
 #include "shader.h"
 #include "shader.ps.h"
+#include "shader.unlit.ps.h"
+#include "shader.textured.ps.h"
+#include "shader.unlit.textured.ps.h"
 #include "shader.vs.h"
+#include "shader.clipspace.vs.h"
+#include "instanced.vs.h"
+#include "line.vs.h"
+#include "floor.vs.h"
+#include "floor.ps.h"
+#include "impostor.vs.h"
+#include "impostor.ps.h"
+#include "impostor.unlit.ps.h"
 
 #include <sdl/sdlexception.h>
 
+#include <span>
+
 namespace robot {
 
 	namespace {
 
-		struct alignas(16) LightPs {
-			glm::vec4 position;	// xyz + padding
-			glm::vec4 color;	// rgba
-			glm::vec4 params;	// x = radius, y = ambientStrength, z = shininess,
+		// Both binaries of a shader, see cmake/CompileShader.cmake.
+		struct ShaderCode {
+			std::span<const uint8_t> dxil;
+			std::span<const uint8_t> spirv;
 		};
 
-		struct alignas(16) LightDataPs {
-			std::array<LightPs, 4> lights;
-			alignas(16) int numLights;
-			glm::vec4 cameraPos; // xyz + padding
-		};
-	}
+		sdl::GpuShader createShader(SDL_GPUDevice* gpuDevice, SDL_GPUShaderCreateInfo createInfo, SDL_GPUShaderFormat format, const ShaderCode& code) {
+			const auto bytes = format == SDL_GPU_SHADERFORMAT_SPIRV ? code.spirv : code.dxil;
+			createInfo.code_size = bytes.size();
+			createInfo.code = bytes.data();
+			createInfo.format = format;
+			return sdl::createGpuShader(gpuDevice, createInfo);
+		}
 
-	static_assert(sizeof(LightPs) == 48, "LightPs size mismatch");
-	static_assert(sizeof(LightDataPs) == 224, "LightDataPs size mismatch");
+	}
 
 	void Shader::load(SDL_GPUDevice* gpuDevice) {
 		SDL_GPUShaderCreateInfo vxCreateInfo{
@@ -30,40 +43,63 @@ namespace robot {
 			.stage = SDL_GPU_SHADERSTAGE_VERTEX,
 			.num_samplers = 0,
 			.num_storage_textures = 0,
-			.num_storage_buffers = 0,
-			.num_uniform_buffers = 1
+			.num_storage_buffers = 1, // Model matrices
+			.num_uniform_buffers = 2
 		};
 		SDL_GPUShaderCreateInfo pxCreateInfo{
 			.entrypoint = "main",
 			.stage = SDL_GPU_SHADERSTAGE_FRAGMENT,
 			.num_samplers = 1,
 			.num_storage_textures = 0,
-			.num_storage_buffers = 0,
+			.num_storage_buffers = 3, // Lights, clusters and light indices
 			.num_uniform_buffers = 1
 		};
 
+		SDL_GPUShaderCreateInfo instancedVxCreateInfo = vxCreateInfo;
+		instancedVxCreateInfo.num_storage_buffers = 0;
+		instancedVxCreateInfo.num_uniform_buffers = 1;
+
+		SDL_GPUShaderCreateInfo lineVxCreateInfo = vxCreateInfo;
+		lineVxCreateInfo.num_storage_buffers = 0;
+
+		// Full-screen triangle from the vertex id.
+		SDL_GPUShaderCreateInfo floorVxCreateInfo = vxCreateInfo;
+		floorVxCreateInfo.num_storage_buffers = 0;
+		floorVxCreateInfo.num_uniform_buffers = 0;
+
+		// Only the projection matrix, the box corner comes from the vertex id.
+		SDL_GPUShaderCreateInfo impostorVxCreateInfo = vxCreateInfo;
+		impostorVxCreateInfo.num_storage_buffers = 0;
+		impostorVxCreateInfo.num_uniform_buffers = 1;
+
+		// The lighting resources and the floor or impostor uniforms at b1.
+		SDL_GPUShaderCreateInfo extendedPxCreateInfo = pxCreateInfo;
+		extendedPxCreateInfo.num_uniform_buffers = 2;
+
+		SDL_GPUShaderFormat format = SDL_GPU_SHADERFORMAT_INVALID;
 		auto driver = SDL_GetGPUDeviceDriver(gpuDevice);
 		if (std::strcmp(driver, "vulkan") == 0) {
-			vxCreateInfo.code_size = ShaderVsSpirvBytes.size();
-			vxCreateInfo.code = ShaderVsSpirvBytes.data();
-			vxCreateInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
-
-			pxCreateInfo.code_size = ShaderPsSpirvBytes.size();
-			pxCreateInfo.code = ShaderPsSpirvBytes.data();
-			pxCreateInfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+			format = SDL_GPU_SHADERFORMAT_SPIRV;
 		} else if (std::strcmp(driver, "direct3d12") == 0) {
-			vxCreateInfo.code_size = ShaderVsDxilBytes.size();
-			vxCreateInfo.code = ShaderVsDxilBytes.data();
-			vxCreateInfo.format = SDL_GPU_SHADERFORMAT_DXIL;
-
-			pxCreateInfo.code_size = ShaderPsDxilBytes.size();
-			pxCreateInfo.code = ShaderPsDxilBytes.data();
-			pxCreateInfo.format = SDL_GPU_SHADERFORMAT_DXIL;
+			format = SDL_GPU_SHADERFORMAT_DXIL;
 		} else {
 			throw sdl::SdlException("[Shader] Unsupported GPU driver for shader loading '{}'", driver);
 		}
-		vertexShader = sdl::createGpuShader(gpuDevice, vxCreateInfo);
-		fragmentShader = sdl::createGpuShader(gpuDevice, pxCreateInfo);
+
+		// The variants have the same resources, unused ones are left out by the compiler.
+		vertexShader = createShader(gpuDevice, vxCreateInfo, format, {ShaderVsDxilBytes, ShaderVsSpirvBytes});
+		clipSpaceVertexShader = createShader(gpuDevice, vxCreateInfo, format, {ShaderClipSpaceVsDxilBytes, ShaderClipSpaceVsSpirvBytes});
+		instancedVertexShader = createShader(gpuDevice, instancedVxCreateInfo, format, {InstancedVsDxilBytes, InstancedVsSpirvBytes});
+		lineVertexShader = createShader(gpuDevice, lineVxCreateInfo, format, {LineVsDxilBytes, LineVsSpirvBytes});
+		fragmentShaders[0] = createShader(gpuDevice, pxCreateInfo, format, {ShaderPsDxilBytes, ShaderPsSpirvBytes});
+		fragmentShaders[1] = createShader(gpuDevice, pxCreateInfo, format, {ShaderUnlitPsDxilBytes, ShaderUnlitPsSpirvBytes});
+		fragmentShaders[2] = createShader(gpuDevice, pxCreateInfo, format, {ShaderTexturedPsDxilBytes, ShaderTexturedPsSpirvBytes});
+		fragmentShaders[3] = createShader(gpuDevice, pxCreateInfo, format, {ShaderUnlitTexturedPsDxilBytes, ShaderUnlitTexturedPsSpirvBytes});
+		floorVertexShader = createShader(gpuDevice, floorVxCreateInfo, format, {FloorVsDxilBytes, FloorVsSpirvBytes});
+		floorFragmentShader = createShader(gpuDevice, extendedPxCreateInfo, format, {FloorPsDxilBytes, FloorPsSpirvBytes});
+		impostorVertexShader = createShader(gpuDevice, impostorVxCreateInfo, format, {ImpostorVsDxilBytes, ImpostorVsSpirvBytes});
+		impostorFragmentShaders[0] = createShader(gpuDevice, extendedPxCreateInfo, format, {ImpostorPsDxilBytes, ImpostorPsSpirvBytes});
+		impostorFragmentShaders[1] = createShader(gpuDevice, extendedPxCreateInfo, format, {ImpostorUnlitPsDxilBytes, ImpostorUnlitPsSpirvBytes});
 	}
 
 	void Shader::uploadProjectionMatrix(SDL_GPUCommandBuffer* commandBuffer, const glm::mat4& projection) {
@@ -72,29 +108,31 @@ namespace robot {
 		static_assert(sizeof(projection) % 16 == 0, "SDL_GPU uses std140 layout, uniform buffer size must be multiple of 16 bytes");
 	}
 
-	void Shader::uploadLightingData(SDL_GPUCommandBuffer* commandBuffer, const LightingData& lightingData) {
-		LightDataPs lightData{
-			.cameraPos = glm::vec4(lightingData.cameraPos, 1.0f)
-		};
-		int i = 0;
-		for (const auto& light : lightingData.lights) {
-			if (i >= lightData.lights.size()) {
-				break;
-			}
-			if (!light.enabled) {
-				continue;
-			}
-
-			lightData.lights[i] = LightPs{
-				.position = glm::vec4(light.position, 1.0f),
-				.color = light.color,
-				.params = glm::vec4(light.radius, light.ambientStrength, light.shininess, 0.0f)
-			};
-			++i;
-		}
-		lightData.numLights = i;
-		// Maps to b1 in fragment shader
-		SDL_PushGPUFragmentUniformData(commandBuffer, 0, &lightData, sizeof(lightData));
+	void Shader::uploadTransformOffset(SDL_GPUCommandBuffer* commandBuffer, uint32_t offset) {
+		// Maps to b1 in vertex shader
+		const glm::uvec4 data{offset, 0, 0, 0};
+		SDL_PushGPUVertexUniformData(commandBuffer, 1, &data, sizeof(data));
+	}
+
+	void Shader::uploadViewportSize(SDL_GPUCommandBuffer* commandBuffer, int width, int height) {
+		// Maps to b1 in the line vertex shader
+		const glm::vec4 data{static_cast<float>(width), static_cast<float>(height), 0.f, 0.f};
+		SDL_PushGPUVertexUniformData(commandBuffer, 1, &data, sizeof(data));
+	}
+
+	void Shader::uploadFloorData(SDL_GPUCommandBuffer* commandBuffer, const FloorUniforms& floorUniforms) {
+		// Maps to b1 in the floor fragment shader
+		SDL_PushGPUFragmentUniformData(commandBuffer, 1, &floorUniforms, sizeof(floorUniforms));
+	}
+
+	void Shader::uploadImpostorData(SDL_GPUCommandBuffer* commandBuffer, const glm::mat4& viewProjection) {
+		// Maps to b1 in the impostor fragment shader
+		SDL_PushGPUFragmentUniformData(commandBuffer, 1, &viewProjection, sizeof(viewProjection));
+	}
+
+	void Shader::uploadLightingData(SDL_GPUCommandBuffer* commandBuffer, const LightUniforms& lightUniforms) {
+		// Maps to b0 in fragment shader
+		SDL_PushGPUFragmentUniformData(commandBuffer, 0, &lightUniforms, sizeof(lightUniforms));
 	}
 
 }
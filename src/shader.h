@@ -1,26 +1,133 @@
 #ifndef ROBOT_SHADER_H
 #define ROBOT_SHADER_H
 
-#include "shader.ps.h"
-#include "shader.vs.h"
+#include "meshcache.h"
 
 #include <sdl/color.h>
 #include <sdl/gpu.h>
 #include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
 
 #include <array>
+#include <cmath>
+#include <cstdint>
 
 namespace robot {
 
-	// Does not need to be std140 because we define the layout in Shader struct.
+	/// Bits of the vertex flags. The low bits select the shader variant of the batch the
+	/// vertex is added to and are not read by the shaders.
+	struct VertexFlag {
+		static constexpr uint32_t None = 0;
+		static constexpr uint32_t NoLight = 1 << 0;
+		static constexpr uint32_t NoProjection = 1 << 1;	// Position is already in clip space.
+		static constexpr uint32_t Texture = 1 << 2;
+
+		// The bits above hold the index of the model matrix in the transform storage buffer,
+		// same value as VERTEX_TRANSFORM_SHIFT in vertex.hlsli.
+		static constexpr uint32_t TransformShift = 8;
+	};
+
+	/// The shaders are compiled once per variant instead of branching on the flags per
+	/// vertex and fragment. A variant is the combination of the VertexFlag bits, the draws
+	/// are bucketed by variant and each variant has its own pipelines.
+	struct ShaderVariant {
+		static constexpr uint32_t Mask = VertexFlag::NoLight | VertexFlag::NoProjection | VertexFlag::Texture;
+		static constexpr uint32_t Count = Mask + 1;
+
+		/// The variant of the vertex or instance flags. Clip space positions have no world
+		/// position to light, so they are always unlit.
+		static constexpr uint32_t get(uint32_t flags) {
+			if (flags & VertexFlag::NoProjection) {
+				flags |= VertexFlag::NoLight;
+			}
+			return flags & Mask;
+		}
+	};
+
+	/// Maps the normal to the unit octahedron unfolded to the square [-1, 1] x [-1, 1].
+	inline glm::vec2 encodeOctahedral(const glm::vec3& normal) {
+		const float sum = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+		if (sum == 0) {
+			return glm::vec2{0.f};
+		}
+		glm::vec2 p = glm::vec2{normal} / sum;
+		if (normal.z < 0) {
+			p = glm::vec2{
+				(1 - std::abs(p.y)) * (p.x >= 0 ? 1.f : -1.f),
+				(1 - std::abs(p.x)) * (p.y >= 0 ? 1.f : -1.f)
+			};
+		}
+		return p;
+	}
+
+#ifdef ROBOT_LEGACY_VERTEX
+	// Unpacked layout, 48 bytes, without flags. The variant comes from the batch.
 	struct Vertex {
 		glm::vec3 position;
 		glm::vec2 tex;
 		glm::vec4 color;
 		glm::vec3 normal;
+
+		// No room for the transform index, the vertices are transformed on the CPU.
+		static constexpr bool HasTransformIndex = false;
+
+		static Vertex create(const glm::vec3& position, const glm::vec3& normal, sdl::Color color, uint32_t flags, const glm::vec2& tex = {}) {
+			return Vertex{position, tex, color, normal};
+		}
+	};
+	static_assert(sizeof(Vertex) == 48);
+#else
+	// Does not need to be std140 because we define the layout in Shader struct.
+	struct Vertex {
+		glm::vec3 position;
+		uint32_t color;		// RGBA8
+		uint32_t normal;	// Octahedral, two snorm16
+		uint32_t tex;		// Two half floats
+		uint32_t flags;		// VertexFlag bits and the transform index
+
+		static constexpr bool HasTransformIndex = true;
+
+		static Vertex create(const glm::vec3& position, const glm::vec3& normal, sdl::Color color, uint32_t flags, const glm::vec2& tex = {}) {
+			return Vertex{
+				.position = position,
+				.color = glm::packUnorm4x8(glm::vec4{color}),
+				.normal = glm::packSnorm2x16(encodeOctahedral(normal)),
+				.tex = glm::packHalf2x16(tex),
+				.flags = flags
+			};
+		}
 	};
+	static_assert(sizeof(Vertex) == 28);
+#endif
 	static_assert(sdl::VertexType<Vertex>, "Vertex must satisfy VertexType");
 
+	/// Per instance data for drawing a cached mesh with the instanced pipeline. The
+	/// variant is the one of the instanced mesh.
+	struct InstanceData {
+		glm::mat4 model;
+		glm::vec4 color;
+		glm::vec2 radius{1.f, 1.f};	// Scale of x and y at z = 0 and z = 1 in model space.
+	};
+
+	/// Per instance data for the line batch, the vertex shader expands each line to a quad.
+	struct LineInstance {
+		glm::vec3 p1;		// World space
+		float width;		// Pixels
+		glm::vec3 p2;
+		uint32_t color;		// RGBA8
+	};
+	static_assert(sizeof(LineInstance) == 32);
+
+	/// Per instance data of a ray-cast capsule, the vertex shader expands it to its bounding
+	/// box and the pixel shader intersects the view ray. A sphere has p1 == p2.
+	struct ImpostorInstance {
+		glm::vec3 p1;		// World space
+		float radius;
+		glm::vec3 p2;
+		uint32_t color;		// RGBA8
+	};
+	static_assert(sizeof(ImpostorInstance) == 32);
+
 	struct Light {
 		glm::vec3 position;
 		sdl::Color color;
@@ -35,13 +142,60 @@ namespace robot {
 		std::vector<Light> lights;
 	};
 
+	/// Light in the storage buffer of the fragment shader, must match Light in shader.ps.hlsl.
+	struct GpuLight {
+		glm::vec4 position;	// xyz = world position
+		glm::vec4 color;
+		glm::vec4 params;	// x = radius, y = ambientStrength, z = shininess
+	};
+	static_assert(sizeof(GpuLight) == 48);
+
+	/// Uniforms of the clustered lighting, must match LightData in shader.ps.hlsl.
+	struct LightUniforms {
+		glm::vec4 cameraPos;
+		glm::vec4 ambient;		// rgb = ambient of all lights, independent of the distance
+		glm::vec4 viewDepth;	// dot(viewDepth, (worldPos, 1)) = distance along the view direction
+		glm::vec2 tileScale;	// Pixels to tiles
+		glm::vec2 sliceScaleBias;	// log(distance) * x + y = depth slice
+		glm::uvec4 clusterSize;	// Tiles in x and y, depth slices
+	};
+	static_assert(sizeof(LightUniforms) % 16 == 0, "SDL_GPU uses std140 layout");
+
+	/// Uniforms of the procedural floor, must match FloorData in floor.ps.hlsl.
+	struct FloorUniforms {
+		glm::mat4 viewProjection;
+		glm::mat4 inverseViewProjection;
+		glm::vec4 color1;	// Checker cells
+		glm::vec4 color2;
+		glm::vec4 lineColor;	// Grid lines
+		float cellSize;		// Meters
+		float lineSpacing;	// Meters between the grid lines
+		float lineWidth;	// Pixels
+		float fadeDistance;	// Meters from the camera, transparent from here
+	};
+	static_assert(sizeof(FloorUniforms) % 16 == 0, "SDL_GPU uses std140 layout");
+
 	struct Shader {
 		void load(SDL_GPUDevice* gpuDevice);
 		
 		static void uploadProjectionMatrix(SDL_GPUCommandBuffer* commandBuffer, const glm::mat4& projection);
 
-		static void uploadLightingData(SDL_GPUCommandBuffer* commandBuffer, const LightingData& lightingData);
+		/// Offset added to the transform index of each vertex in the following draw calls.
+		static void uploadTransformOffset(SDL_GPUCommandBuffer* commandBuffer, uint32_t offset);
+
+		/// The lights themselves are in fragment storage buffers, see Graphic::setLighting.
+		static void uploadLightingData(SDL_GPUCommandBuffer* commandBuffer, const LightUniforms& lightUniforms);
 
+		/// Viewport size in pixels for the line vertex shader, shares b1 with the transform offset.
+		static void uploadViewportSize(SDL_GPUCommandBuffer* commandBuffer, int width, int height);
+
+		/// The floor pixel shader reads the lighting data as well.
+		static void uploadFloorData(SDL_GPUCommandBuffer* commandBuffer, const FloorUniforms& floorUniforms);
+
+		/// The impostor pixel shader writes the depth of the hit point, it projects it itself.
+		static void uploadImpostorData(SDL_GPUCommandBuffer* commandBuffer, const glm::mat4& viewProjection);
+
+#ifdef ROBOT_LEGACY_VERTEX
 		static constexpr std::array<SDL_GPUVertexAttribute, 4> attributes = {
 			// position maps to TEXCOORD0
 			SDL_GPUVertexAttribute{
@@ -72,9 +226,180 @@ namespace robot {
 					.offset = offsetof(Vertex, normal)
 			}
 		};
+#else
+		static constexpr std::array<SDL_GPUVertexAttribute, 5> attributes = {
+			// position maps to TEXCOORD0
+			SDL_GPUVertexAttribute{
+				.location = 0,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(Vertex, position)
+			},
+			// color maps to TEXCOORD1
+			SDL_GPUVertexAttribute{
+				.location = 1,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM,
+				.offset = offsetof(Vertex, color)
+			},
+			// normal maps to TEXCOORD2
+			SDL_GPUVertexAttribute{
+				.location = 2,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_SHORT2_NORM,
+				.offset = offsetof(Vertex, normal)
+			},
+			// tex maps to TEXCOORD3
+			SDL_GPUVertexAttribute{
+				.location = 3,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_HALF2,
+				.offset = offsetof(Vertex, tex)
+			},
+			// flags maps to TEXCOORD4
+			SDL_GPUVertexAttribute{
+				.location = 4,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_UINT,
+				.offset = offsetof(Vertex, flags)
+			}
+		};
+#endif
+
+		// Slot 0 is the cached mesh and slot 1 the instances, same fragment shader.
+		static constexpr std::array<SDL_GPUVertexAttribute, 8> instancedAttributes = {
+			SDL_GPUVertexAttribute{
+				.location = 0,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(MeshVertex, position)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 1,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(MeshVertex, normal)
+			},
+			// The model matrix, one column each.
+			SDL_GPUVertexAttribute{
+				.location = 2,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+				.offset = offsetof(InstanceData, model)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 3,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+				.offset = offsetof(InstanceData, model) + sizeof(glm::vec4)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 4,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+				.offset = offsetof(InstanceData, model) + 2 * sizeof(glm::vec4)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 5,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+				.offset = offsetof(InstanceData, model) + 3 * sizeof(glm::vec4)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 6,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4,
+				.offset = offsetof(InstanceData, color)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 7,
+				.buffer_slot = 1,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2,
+				.offset = offsetof(InstanceData, radius)
+			}
+		};
+
+		// Only instance data, the corner of the quad comes from SV_VertexID.
+		static constexpr std::array<SDL_GPUVertexAttribute, 4> lineAttributes = {
+			SDL_GPUVertexAttribute{
+				.location = 0,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(LineInstance, p1)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 1,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT,
+				.offset = offsetof(LineInstance, width)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 2,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(LineInstance, p2)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 3,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM,
+				.offset = offsetof(LineInstance, color)
+			}
+		};
+
+		// Only instance data, the corner of the box comes from SV_VertexID.
+		static constexpr std::array<SDL_GPUVertexAttribute, 4> impostorAttributes = {
+			SDL_GPUVertexAttribute{
+				.location = 0,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(ImpostorInstance, p1)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 1,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT,
+				.offset = offsetof(ImpostorInstance, radius)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 2,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3,
+				.offset = offsetof(ImpostorInstance, p2)
+			},
+			SDL_GPUVertexAttribute{
+				.location = 3,
+				.buffer_slot = 0,
+				.format = SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM,
+				.offset = offsetof(ImpostorInstance, color)
+			}
+		};
+
+		/// The triangle vertex shader of the variant, projected or in clip space.
+		SDL_GPUShader* getVertexShader(uint32_t variant) const {
+			return (variant & VertexFlag::NoProjection) ? clipSpaceVertexShader.get() : vertexShader.get();
+		}
+
+		/// The fragment shader of the variant, lit or unlit and textured or untextured.
+		SDL_GPUShader* getFragmentShader(uint32_t variant) const {
+			const uint32_t flags = ShaderVariant::get(variant);
+			return fragmentShaders[((flags & VertexFlag::NoLight) ? 1 : 0) + ((flags & VertexFlag::Texture) ? 2 : 0)].get();
+		}
+
+		/// The impostor pixel shader of the variant, lit or unlit. Impostors are never textured.
+		SDL_GPUShader* getImpostorFragmentShader(uint32_t variant) const {
+			return impostorFragmentShaders[(ShaderVariant::get(variant) & VertexFlag::NoLight) ? 1 : 0].get();
+		}
 
 		sdl::GpuShader vertexShader;
-		sdl::GpuShader fragmentShader;
+		sdl::GpuShader clipSpaceVertexShader;
+		sdl::GpuShader instancedVertexShader;
+		sdl::GpuShader lineVertexShader;
+		std::array<sdl::GpuShader, 4> fragmentShaders;	// Lit, unlit, lit textured and unlit textured.
+		sdl::GpuShader floorVertexShader;
+		sdl::GpuShader floorFragmentShader;
+		sdl::GpuShader impostorVertexShader;
+		std::array<sdl::GpuShader, 2> impostorFragmentShaders;	// Lit and unlit.
 	};
 
 }
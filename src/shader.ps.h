@@ -1,212 +0,0 @@
-#pragma once
-
-// Generated by compile_shaders.py. Do not edit manually.
-#include <SDL3/SDL_gpu.h>
-
-#include <cstdint>
-#include <array>
-
-namespace robot {
-
-	constexpr std::array<uint8_t, 6020> ShaderPsDxilBytes{
-		 68, 88, 66, 67, 76, 57,185, 45,173,221,126, 84,201,251,109,114, 66, 71, 80,142,  1,  0,  0,  0,132, 23,  0,  0,  7,  0,  0,  0, 60,  0,  0,  0, 76,  0,  0,  0, 24,  1,  0,  0, 84,  1,  0,  0,212,  2,
-		  0,  0,200, 11,  0,  0,228, 11,  0,  0, 83, 70, 73, 48,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73, 83, 71, 49,196,  0,  0,  0,  5,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,168,  0,  0,  0,
-		  0,  0,  0,  0,  1,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,  3,  3,
-		  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  2,  0,  0,  0, 15, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  1,  0,  0,  0,
-		  0,  0,  0,  0,  3,  0,  0,  0,  3,  0,  0,  0,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  4,  0,  0,  0,  7,  7,  0,  0,  0,  0,
-		  0,  0, 83, 86, 95, 80,111,115,105,116,105,111,110,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 67, 79, 76, 79, 82,  0,  0, 79, 83, 71, 49, 52,  0,  0,  0,  1,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
-		 40,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, 83, 86, 95, 84, 97,114,103,101,116,  0,  0,  0, 80, 83, 86, 48,120,  1,  0,  0, 52,  0,
-		  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,  0,  0,  0,  0,  5,  1,  0,  5,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-		 34,  0,  0,  0,  3,  0,  0,  0, 24,  0,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-		  0,  0, 14,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 40,  0,  0,  0,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 67, 79,
-		 76, 79, 82,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0,109, 97,105,110,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0, 16,  0,  0,  0,  0,  0,
-		  0,  0,  0,  0,  0,  0,  1,  0, 68,  3,  3,  4,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  1, 66,  0,  3,  2,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  1,  2, 68,  0,  3,  2,  0,  0, 16,  0,  0,  0,
-		  1,  0,  0,  0,  1,  3, 67,  0,  3,  2,  0,  0, 25,  0,  0,  0,  2,  0,  0,  0,  1,  4, 67,  0,  3,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0, 68, 16,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-		  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,  4,  0,  0,  0,  8,  0,  0,  0,  7,  0,  0,  0,  7,  0,  0,  0,
-		  7,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  7,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0, 83, 84, 65, 84,236,  8,  0,  0, 96,  0,  0,  0, 59,  2,  0,  0, 68, 88, 73, 76,  0,  1,  0,  0, 16,  0,
-		  0,  0,212,  8,  0,  0, 66, 67,192,222, 33, 12,  0,  0, 50,  2,  0,  0, 11,130, 32,  0,  2,  0,  0,  0, 19,  0,  0,  0,  7,129, 35,145, 65,200,  4, 73,  6, 16, 50, 57,146,  1,132, 12, 37,  5,  8, 25,
-		 30,  4,139, 98,128, 24, 69,  2, 66,146, 11, 66,196, 16, 50, 20, 56,  8, 24, 75, 10, 50, 98,136, 72,144, 20, 32, 67, 70,136,165,  0, 25, 50, 66,228, 72, 14,144, 17, 35,196, 80, 65, 81,129,140,225,131,
-		229,138,  4, 49, 70,  6, 81, 24,  0,  0,  8,  0,  0,  0, 27,140,224,255,255,255,255,  7, 64,  2,168, 13,132,240,255,255,255,255,  3, 32,109, 48,134,255,255,255,255, 31,  0,  9,168,  0, 73, 24,  0,  0,
-		  3,  0,  0,  0, 19,130, 96, 66, 32, 76,  8,  6,  0,  0,  0,  0,137, 32,  0,  0, 94,  0,  0,  0, 50, 34,136,  9, 32,100,133,  4, 19, 35,164,132,  4, 19, 35,227,132,161,144, 20, 18, 76,140,140, 11,132,
-		196, 76, 16,168,193,  8, 64,  9,  0, 10,102,  0,230,  8,192, 96,142,  0, 41,198, 64, 16, 68, 65,144, 81, 12,128, 32,136, 98, 32,228,166,225,242, 39,236, 33, 36,127, 37,164,149,152,252,226,182, 81, 49,
-		 12,195, 64, 80,113,207,112,249, 19,246, 16,146, 31,  2,205,176, 16, 40, 88, 10,163, 16, 12, 51, 12,195, 64, 16,196, 64, 77, 65,  6, 98, 24,134, 97, 24,232, 41,195, 64, 12, 20, 21, 98, 32,134,129,166,
-		163,134,203,159,176,135,144,124,110,163,138,149,152,252,226,182, 17, 49, 12,195, 80,136,138, 96,  8,178,142, 26, 46,127,194, 30, 66,242,185,141, 42, 86, 98,242,145,219, 70,  4, 65, 16, 68, 33, 48,130,
-		 33, 40,155, 35,  8,138,193, 16,  5, 65,108,196, 13,  4, 12, 35, 16,195, 76,109, 48, 14,236, 16, 14,243, 48, 15,110, 64, 11,229,128, 15,244, 80, 15,242, 80, 14,114, 64, 10,124, 96, 15,229, 48, 14,244,
-		240, 14,242,192,  7,230,192, 14,239, 16, 14,244,192,  6, 96, 64,  7,126,  0,  6,126,160,  7,122,208, 14,233,  0, 15,243,240, 11,244,144, 15,240, 80, 14, 40, 32,102, 18,131,113, 96,135,112,152,135,121,
-		112,  3, 90, 40,  7,124,160,135,122,144,135,114,144,  3, 82,224,  3,123, 40,135,113,160,135,119,144,  7, 62, 48,  7,118,120,135,112,160,  7, 54,  0,  3, 58,240,  3, 48,240,  3, 36,124, 32,133,199, 72,
-		 83, 68,  9,147, 95, 34,198, 49,161,225,251,190, 36, 24, 47, 41, 17,227,152, 58, 96,  2,208, 64, 18, 31,149, 55, 73, 83, 68,  9,147,207,  2,204,179, 16, 17, 59,  1, 19,129,  2,130,206,172, 32,  0,  0,
-		 19, 20,114,192,135,116, 96,135, 54,104,135,121,104,  3,114,192,135, 13,175, 80, 14,109,208, 14,122, 80, 14,109,  0, 15,122, 48,  7,114,160,  7,115, 32,  7,109,144, 14,113,160,  7,115, 32,  7,109,144,
-		 14,120,160,  7,115, 32,  7,109,144, 14,113, 96,  7,122, 48,  7,114,208,  6,233, 48,  7,114,160,  7,115, 32,  7,109,144, 14,118, 64,  7,122, 96,  7,116,208,  6,230, 16,  7,118,160,  7,115, 32,  7,109,
-		 96, 14,115, 32,  7,122, 48,  7,114,208,  6,230, 96,  7,116,160,  7,118, 64,  7,109,224, 14,120,160,  7,113, 96,  7,122, 48,  7,114,160,  7,118, 64,  7, 67,158,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,
-		  0,134, 60,  6, 16,  0,  1,  0,  0,  0,  0,  0,  0,  0, 12,121, 16, 32,  0,  4,  0,  0,  0,  0,  0,  0,  0, 24,242, 52, 64,  0, 12,  0,  0,  0,  0,  0,  0,  0, 48,228,121,128,  0,  8,  0,  0,  0,  0,
-		  0,  0,  0, 96,200, 19,  1,  1, 16,  0,  0,  0,  0,  0,  0,  0,192,144,103,  2,  2, 32,  0,  0,  0,  0,  0,  0,  0,128, 33,143,  5,  4,192,  0,  0,  0,  0,  0,  0,  0,  0, 67,158, 12,  8,128,  1,  0,
-		  0,  0,  0,  0,  0,  0,134, 60, 28, 16,  0,  3,  0,  0,  0,  0,  0,  0,  0,100,129,  0, 26,  0,  0,  0, 50, 30,152, 24, 25, 17, 76,144,140,  9, 38, 71,198,  4, 67, 34, 74, 96,  4,160, 24,138,160, 36,
-		202,160,128,  7, 10,172, 28, 74,163, 16, 10,164,128, 10,112,160, 20, 10,116,160, 60, 74, 48,160, 48,  5, 10,131,138,146, 40,131, 66, 24,  1, 40,130,  2,161,173,  6, 72,156,  1,160,113,  6,128,202, 25,
-		  0, 50,103,  0,  8,157,  1,160,116,172,106, 34,  0,  0,  0,158,  7,  0,  2,129, 64,142,227,  0,142,227,  0,  0,  0,  0,121, 24,  0,  0,207,  0,  0,  0, 26,  3, 76,144, 70,  2, 19,196, 49, 32,195, 27,
-		 67,129,147, 75,179, 11,163, 43, 75,  1,137,113,193,113,129,113,161,201,129,185,  1, 65,129,177,153,193,137, 49,147, 33,187, 73,217, 16,  4, 19,  4, 66,153, 32, 16,203,  6, 97, 32, 54,  8,  4, 65,  1,
-		110,110,130, 64, 48, 27,134,  3, 33, 38,  8, 98, 80,  6, 60,168,202,240,232,234,228,202, 38,  8, 68, 51, 65, 32,156, 13,  2,209,108, 72,  8,101, 97,136,129, 33,156, 13,193, 51, 65, 48,  3, 52, 96,194,
-		148,118,134, 70, 71, 20, 70, 23, 54, 65, 32,158,  9,  2,  1,109, 64,136, 72,154,136,129,  2, 54,  4,213,  4,  1, 13,210,128,199, 84, 88, 27, 28, 91,153,220,  6,132,184, 48,134, 24,  8, 96, 67,144,109,
-		 32, 32,192,210, 38,  8, 99, 96,  6, 19,  4, 34, 34,  2,247, 54,151, 70,151,246,230, 54, 65, 32,164,  9,  2, 49, 77, 16,  8,106,  3,130,120, 19,241, 53, 96, 16,  6, 44,198,222,216,222,228, 38,  8, 68,
-		181,  1, 65,198, 96, 34,131,175,  1,131, 48,160,  1, 23, 38, 23,214, 54, 55, 65, 32,172, 13,  8, 98,  6,211, 25,124, 13, 24,132,193,  6,162, 19,131, 50, 64,131,  9, 66, 25,156,  1, 13,182,180, 51, 52,
-		186,185,  9,194, 70,  6, 27, 12,100, 13, 38,162, 97,  3, 42,108,105,103,104,116, 67,111,117,110,116, 19,  4,226,154, 32, 16,216,  6,  4,113,131,233, 13, 62, 56,104,216,128,201, 88, 88, 91,153, 92, 24,
-		212,219,220,  4,129,200, 54, 40,136, 28, 76,115,240, 53, 13, 27,128, 65, 24,108, 32,168, 54,136,  3, 58,216, 80, 16, 92, 26,168, 65, 29, 76, 16,  4, 96,  3,176, 97, 32,240,  0, 15, 54,  4,121,176, 97,
-		 24,238, 64, 15, 38,  8,105,160,  6, 27,  2, 62, 32,209, 22,150,230,198,101,202,234, 11,234,109, 46,141, 46,237,205,109,130, 80,120, 19,132,226,219, 16, 16, 19,132,  2, 12, 38,  8, 69, 24,108, 88,136,
-		 63,  0,133, 80, 16,133, 81, 24, 70,129, 32,  5,128,  8, 85, 17,214,208,211,147, 20,209,  4,161, 16,131, 13,194, 52,109, 88,  6, 83,  0,  5, 82, 16,133, 83, 24, 78, 97, 32,  5, 84, 96, 49,244,196,244,
-		 36, 53, 65, 32,180, 13,194,180, 10, 27, 22, 70, 21, 64,129, 20, 68,225, 20,134, 81, 96, 72,129, 21, 54,  4,195,  6, 97,250, 54, 44,147, 41,128,  2, 41,184,194, 41, 12,161, 48,145,194, 43,108,  8,152,
-		 13, 75, 24,152,  2, 40,144, 66, 44,156,194, 16, 10, 97, 64, 10,175,176,161, 40,133, 84,104,  5, 88,144,  5, 38, 83, 86, 95, 84, 97,114,103,101,116, 19,132, 98, 12, 54, 44,  4, 45,128, 66, 45,136,  2,
-		 41, 12,163, 64,144,  2, 43,108,  8,108, 97,195, 48, 11,183,  0,108, 40,238,192, 15,112, 97,  3,136,136,201,133,185,141,161,149,205,209, 48, 99,123, 11,163,155,155, 32, 16, 27,139, 52,183, 57,186,185,
-		  9,  2,193,145, 72,115,163,155,163, 49,151,118,246,197, 70, 54, 65, 32, 58, 26,115,105,103, 95,115,116, 68,232,202,240,190,220,222,228,218, 88,212,165,185,209,205,109,128,116, 33, 12,118,129, 23,122,
-		193, 23,126,  1,  1,135,112, 16,135, 48, 24,135,129, 28,152, 42,108,108,118,109, 46,105,100,101,110,116, 83,130,160, 10, 25,158,139, 93,153,220, 92,218,155,219,148,128,104, 66,134,231, 98, 23,198,102,
-		 87, 38, 55, 37, 40,234,144,225,185,204,161,133,145,149,201, 53,189,145,149,177, 77,  9,144, 50,100,120, 46,114,101,115,111,117,114, 99,101,115, 83,  2,173, 18, 25,158, 11, 93, 30, 92, 89,144,155,219,
-		 27, 93, 24, 93,218,155,219,220, 20,161, 14,244,160, 14, 25,158,139, 93, 90,217, 93, 18,217, 20, 93, 24, 93,217,148,128, 15,234,144,225,185,148,185,209,201,229, 65,189,165,185,209,205, 77,  9,112,161,
-		 11, 25,158,203,216, 91,157, 27, 93,153,220,220,148,128, 28,  0,121, 24,  0,  0, 81,  0,  0,  0, 51,  8,128, 28,196,225, 28,102, 20,  1, 61,136, 67, 56,132,195,140, 66,128,  7,121,120,  7,115,152,113,
-		 12,230,  0, 15,237, 16, 14,244,128, 14, 51, 12, 66, 30,194,193, 29,206,161, 28,102, 48,  5, 61,136, 67, 56,132,131, 27,204,  3, 61,200, 67, 61,140,  3, 61,204,120,140,116,112,  7,123,  8,  7,121, 72,
-		135,112,112,  7,122,112,  3,118,120,135,112, 32,135, 25,204, 17, 14,236,144, 14,225, 48, 15,110, 48, 15,227,240, 14,240, 80, 14, 51, 16,196, 29,222, 33, 28,216, 33, 29,194, 97, 30,102, 48,137, 59,188,
-		131, 59,208, 67, 57,180,  3, 60,188,131, 60,132,  3, 59,204,240, 20,118, 96,  7,123,104,  7, 55,104,135,114,104,  7, 55,128,135,112,144,135,112, 96,  7,118, 40,  7,118,248,  5,118,120,135,119,128,135,
-		 95,  8,135,113, 24,135,114,152,135,121,152,129, 44,238,240, 14,238,224, 14,245,192, 14,236, 48,  3, 98,200,161, 28,228,161, 28,204,161, 28,228,161, 28,220, 97, 28,202, 33, 28,196,129, 29,202, 97,  6,
-		214,144, 67, 57,200, 67, 57,152, 67, 57,200, 67, 57,184,195, 56,148, 67, 56,136,  3, 59,148,195, 47,188,131, 60,252,130, 59,212,  3, 59,176,195, 12,196, 33,  7,124,112,  3,122, 40,135,118,128,135, 25,
-		209, 67, 14,248,224,  6,228, 32, 14,231,224,  6,246, 16, 14,242,192, 14,225,144, 15,239, 80, 15,244, 48,131,129,200,  1, 31,220, 64, 28,228,161, 28,194, 97, 29,220, 64, 28,228,  1,  0,  0,  0,113, 32,
-		  0,  0, 39,  0,  0,  0,102,  0, 13,151,239, 60,126,128, 52, 64,132,249,197,109,219,193, 54, 92,190,243,248, 66, 64, 21,  5, 17,149, 14, 48,148,132,  1,  8,152, 95,220,182, 33,108,195,229, 59,143, 47,
-		  4, 84, 81, 16, 81,233,  0, 67, 73, 24,128,128,249,200,109, 91,130, 52, 92,190,243,248, 66, 68,  0, 19, 17,  2,205,176, 16, 70,224, 12,151,239, 60,254,224, 76,183, 95,220,182,  5, 76,195,229, 59,143,
-		191, 56,192, 32, 54, 15, 53,249,197,109,219,  0, 52, 92,190,243,248, 18,192, 60, 11,225, 23,183,109,  2,213,112,249,206,227, 75,147, 19, 17, 40, 53, 61,212,228, 23,183,109,  5,207,112,249,206,227, 83,
-		 13, 16, 97,126,113,219,  6, 64, 48,  0,210,  0,  0,  0,  0,  0, 72, 65, 83, 72, 20,  0,  0,  0,  0,  0,  0,  0,198, 85, 48,196, 79, 53,177, 72, 14,191, 58, 46,226,244, 49,180, 68, 88, 73, 76,152, 11,
-		  0,  0, 96,  0,  0,  0,230,  2,  0,  0, 68, 88, 73, 76,  0,  1,  0,  0, 16,  0,  0,  0,128, 11,  0,  0, 66, 67,192,222, 33, 12,  0,  0,221,  2,  0,  0, 11,130, 32,  0,  2,  0,  0,  0, 19,  0,  0,  0,
-		  7,129, 35,145, 65,200,  4, 73,  6, 16, 50, 57,146,  1,132, 12, 37,  5,  8, 25, 30,  4,139, 98,128, 24, 69,  2, 66,146, 11, 66,196, 16, 50, 20, 56,  8, 24, 75, 10, 50, 98,136, 72,144, 20, 32, 67, 70,
-		136,165,  0, 25, 50, 66,228, 72, 14,144, 17, 35,196, 80, 65, 81,129,140,225,131,229,138,  4, 49, 70,  6, 81, 24,  0,  0,  8,  0,  0,  0, 27,140,224,255,255,255,255,  7, 64,  2,168, 13,132,240,255,255,
-		255,255,  3, 32,109, 48,134,255,255,255,255, 31,  0,  9,168,  0, 73, 24,  0,  0,  3,  0,  0,  0, 19,130, 96, 66, 32, 76,  8,  6,  0,  0,  0,  0,137, 32,  0,  0, 95,  0,  0,  0, 50, 34,136,  9, 32,100,
-		133,  4, 19, 35,164,132,  4, 19, 35,227,132,161,144, 20, 18, 76,140,140, 11,132,196, 76, 16,172,193,  8, 64,  9,  0, 10,102,  0,230,  8,192, 96,142,  0, 41,198, 64, 16, 68, 65,144, 81, 12,128, 32,136,
-		 98, 32,228,166,225,242, 39,236, 33, 36,127, 37,164,149,152,252,226,182, 81, 49, 12,195, 64, 80,113,207,112,249, 19,246, 16,146, 31,  2,205,176, 16, 40, 88, 10,163, 16, 12, 51, 12,195, 64, 16,196, 64,
-		 77, 65,  6, 98, 24,134, 97, 24,232, 41,195, 64, 12, 20, 21, 98, 32,134,129,166,163,134,203,159,176,135,144,124,110,163,138,149,152,252,226,182, 17, 49, 12,195, 80,136,138, 96,  8,178,142, 26, 46,127,
-		194, 30, 66,242,185,141, 42, 86, 98,242,145,219, 70,  4, 65, 16, 68, 33, 48,130, 33, 40,155, 35,  8,138,193, 16,  5, 65,108,196, 13,  4, 12, 35, 16,195, 76,109, 48, 14,236, 16, 14,243, 48, 15,110, 64,
-		 11,229,128, 15,244, 80, 15,242, 80, 14,114, 64, 10,124, 96, 15,229, 48, 14,244,240, 14,242,192,  7,230,192, 14,239, 16, 14,244,192,  6, 96, 64,  7,126,  0,  6,126,160,  7,122,208, 14,233,  0, 15,243,
-		240, 11,244,144, 15,240, 80, 14, 40, 32,102, 18,131,113, 96,135,112,152,135,121,112,  3, 90, 40,  7,124,160,135,122,144,135,114,144,  3, 82,224,  3,123, 40,135,113,160,135,119,144,  7, 62, 48,  7,118,
-		120,135,112,160,  7, 54,  0,  3, 58,240,  3, 48,240,  3, 36,124, 32,133,199, 72, 83, 68,  9,147, 95, 34,198, 49,161,225,251,190, 36, 24, 47, 41, 17,227,152, 58, 96,  2,208, 64, 18, 31,149, 55, 73, 83,
-		 68,  9,147,207,  2,204,179, 16, 17, 59,  1, 19,129,  2,130,206,172, 32,166,  0,  0,  0,  0,  0, 19, 20,114,192,135,116, 96,135, 54,104,135,121,104,  3,114,192,135, 13,175, 80, 14,109,208, 14,122, 80,
-		 14,109,  0, 15,122, 48,  7,114,160,  7,115, 32,  7,109,144, 14,113,160,  7,115, 32,  7,109,144, 14,120,160,  7,115, 32,  7,109,144, 14,113, 96,  7,122, 48,  7,114,208,  6,233, 48,  7,114,160,  7,115,
-		 32,  7,109,144, 14,118, 64,  7,122, 96,  7,116,208,  6,230, 16,  7,118,160,  7,115, 32,  7,109, 96, 14,115, 32,  7,122, 48,  7,114,208,  6,230, 96,  7,116,160,  7,118, 64,  7,109,224, 14,120,160,  7,
-		113, 96,  7,122, 48,  7,114,160,  7,118, 64,  7, 67,158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,134, 60,  6, 16,  0,  1,  0,  0,  0,  0,  0,  0,  0, 12,121, 16, 32,  0,  4,  0,  0,  0,  0,  0,  0,
-		  0, 24,242, 52, 64,  0, 12,  0,  0,  0,  0,  0,  0,  0, 48,228,121,128,  0,  8,  0,  0,  0,  0,  0,  0,  0, 96,200, 19,  1,  1, 16,  0,  0,  0,  0,  0,  0,  0,192,144,103,  2,  2, 32,  0,  0,  0,  0,
-		  0,  0,  0,128, 33,143,  5,  4,192,  0,  0,  0,  0,  0,  0,  0,  0, 67,158, 12,  8,128,  1,  0,  0,  0,  0,  0,  0,  0,134, 60, 28, 16,  0,  3,  0,  0,  0,  0,  0,  0,  0,100,129,  0, 19,  0,  0,  0,
-		 50, 30,152, 20, 25, 17, 76,144,140,  9, 38, 71,198,  4, 67, 34, 74, 96,  4,160, 36,138,161,  8,202,160,128,  7,202,163, 28, 10,129,138,146, 40,131, 66, 24,  1, 40,130,  2, 33,113,  6,128,204, 25,  0,
-		 66,103,  0, 40, 29,171,154,  8,  0,  0,128,231,  1,128, 64, 32,144,227, 56,128,227, 56,  0,  0,  0,  0,121, 24,  0,  0,118,  0,  0,  0, 26,  3, 76,144, 70,  2, 19,196, 49, 32,195, 27, 67,129,147, 75,
-		179, 11,163, 43, 75,  1,137,113,193,113,129,113,161,201,129,185,  1, 65,129,177,153,193,137, 49,147, 33,187, 73,217, 16,  4, 19,  4, 66,153, 32, 16,203,  6, 97, 32, 38,  8,  4,179, 65, 24, 12, 10,112,
-		115, 19,  4,162,217, 48, 32,  9, 49, 65, 16,  3,141,192,  4,129,112, 54,  8,132,177, 33, 33, 22,166, 33,134,134,112, 54,  4,207,  4,193, 12,182,  9,  2,241, 76, 16,  8,104,  3, 66, 68,140, 68, 12, 19,
-		176, 33,160, 38,  8,104,192,109, 64,  8,139,105,136,129,  0, 54,  4,215,  6,  2,  2, 42,108,130,144,  6,221,134, 64,155, 32,  8,  0,137,182,176, 52, 55, 46, 83, 86, 95, 80,111,115,105,116,105,111,110,
-		 19,132,130,154, 32, 20,213,134,128,152, 32, 20,214,  4,161,184, 54, 44,132,247,129, 65, 24,136,193, 32,  6,196, 24,  0, 68,168,138,176,134,158,158,164,136, 38,  8,  5,182, 65,144,164, 13,203, 80,  6,
-		223, 24,132,129, 25, 12,102, 48,140,193, 25,176, 24,122, 98,122,146,154, 32, 16,209,  6, 65, 82,131, 13, 75,147,  6,223, 24,132,129, 25, 12, 98,208,140,193, 26,108,  8,134,  9,  2, 33,109, 16, 36, 55,
-		216,176, 72,101,240,141, 65, 27,152,193,  0,  6,210, 24,188,193,  4,129,152, 54,  4,205,134, 37, 14,202,224, 27,  3, 57, 48,131,  1, 12,226, 96, 12,222, 96, 67, 65,  6,104,192,  6,112, 48,  7, 76,166,
-		172,190,168,194,228,206,202,232, 38,  8, 69,182, 97, 33,234,224,179,131, 48, 24,131, 65, 12,136, 49, 88,131, 13,193, 29,108, 24,232,  0, 15,128, 13,  5,215,229, 65,  6, 84, 97, 99,179,107,115, 73, 35,
-		 43,115,163,155, 18,  4, 85,200,240, 92,236,202,228,230,210,222,220,166,  4, 68, 19, 50, 60, 23,187, 48, 54,187, 50,185, 41,129, 81,135, 12,207,101, 14, 45,140,172, 76,174,233,141,172,140,109, 74,144,
-		148, 33,195,115,145, 43,155,123,171,147, 27, 43,155,155, 18, 96,117,200,240, 92,236,210,202,238,146,200,166,232,194,232,202,166,  4, 90, 29, 50, 60,151, 50, 55, 58,185, 60,168,183, 52, 55,186,185, 41,
-		 65, 30,  0,  0,  0,  0,121, 24,  0,  0, 81,  0,  0,  0, 51,  8,128, 28,196,225, 28,102, 20,  1, 61,136, 67, 56,132,195,140, 66,128,  7,121,120,  7,115,152,113, 12,230,  0, 15,237, 16, 14,244,128, 14,
-		 51, 12, 66, 30,194,193, 29,206,161, 28,102, 48,  5, 61,136, 67, 56,132,131, 27,204,  3, 61,200, 67, 61,140,  3, 61,204,120,140,116,112,  7,123,  8,  7,121, 72,135,112,112,  7,122,112,  3,118,120,135,
-		112, 32,135, 25,204, 17, 14,236,144, 14,225, 48, 15,110, 48, 15,227,240, 14,240, 80, 14, 51, 16,196, 29,222, 33, 28,216, 33, 29,194, 97, 30,102, 48,137, 59,188,131, 59,208, 67, 57,180,  3, 60,188,131,
-		 60,132,  3, 59,204,240, 20,118, 96,  7,123,104,  7, 55,104,135,114,104,  7, 55,128,135,112,144,135,112, 96,  7,118, 40,  7,118,248,  5,118,120,135,119,128,135, 95,  8,135,113, 24,135,114,152,135,121,
-		152,129, 44,238,240, 14,238,224, 14,245,192, 14,236, 48,  3, 98,200,161, 28,228,161, 28,204,161, 28,228,161, 28,220, 97, 28,202, 33, 28,196,129, 29,202, 97,  6,214,144, 67, 57,200, 67, 57,152, 67, 57,
-		200, 67, 57,184,195, 56,148, 67, 56,136,  3, 59,148,195, 47,188,131, 60,252,130, 59,212,  3, 59,176,195, 12,196, 33,  7,124,112,  3,122, 40,135,118,128,135, 25,209, 67, 14,248,224,  6,228, 32, 14,231,
-		224,  6,246, 16, 14,242,192, 14,225,144, 15,239, 80, 15,244, 48,131,129,200,  1, 31,220, 64, 28,228,161, 28,194, 97, 29,220, 64, 28,228,  1,  0,  0,  0,113, 32,  0,  0, 39,  0,  0,  0,102,  0, 13,151,
-		239, 60,126,128, 52, 64,132,249,197,109,219,193, 54, 92,190,243,248, 66, 64, 21,  5, 17,149, 14, 48,148,132,  1,  8,152, 95,220,182, 33,108,195,229, 59,143, 47,  4, 84, 81, 16, 81,233,  0, 67, 73, 24,
-		128,128,249,200,109, 91,130, 52, 92,190,243,248, 66, 68,  0, 19, 17,  2,205,176, 16, 70,224, 12,151,239, 60,254,224, 76,183, 95,220,182,  5, 76,195,229, 59,143,191, 56,192, 32, 54, 15, 53,249,197,109,
-		219,  0, 52, 92,190,243,248, 18,192, 60, 11,225, 23,183,109,  2,213,112,249,206,227, 75,147, 19, 17, 40, 53, 61,212,228, 23,183,109,  5,207,112,249,206,227, 83, 13, 16, 97,126,113,219,  6, 64, 48,  0,
-		210,  0, 97, 32,  0,  0,  8,  1,  0,  0, 19,  4, 73, 44, 16,  0,  0,  0, 12,  0,  0,  0,180,141,  0, 80, 81,  2, 68,148, 74,185,204,  0,148, 91,217,149, 76, 41,148, 92, 97,148, 81,225,149, 70,193,208,
-		 48, 70,  0,130, 32,136,127, 99,  4, 32,  8,130,252, 47,204,  0,140,  0,  0,  0, 35,  6,  9,  0,130, 96,192,161,129,162,153,129, 25, 76, 35,  6,  9,  0,130, 96,192,165,193,210,157,193, 25, 80, 35,  6,
-		  9,  0,130, 96,192,169,  1,179,161,  1, 26, 84, 35,  6,  9,  0,130, 96, 96,204, 65, 24,132, 65, 26,116,210,136, 65,  2,128, 32, 24, 24,116, 32,  6, 98,160,  6,214, 52, 98,144,  0, 32,  8,  6, 70, 29,
-		140,193, 24,172,129, 71,141, 24, 36,  0,  8,130,129, 97,  7,100,128,  6,108,  0,  6,213,136, 65,  2,128, 32, 24, 24,119, 80,  6,105,208,  6,153, 53, 98,144,  0, 32,  8,  6,  6, 30,152,129, 26,184, 65,
-		 24, 92, 35,  6,  9,  0,130, 96, 96,228,193, 25,176,193, 27,140,  1, 54, 98,144,  0, 32,  8,  6,134, 30,160, 65, 27,192,  1,151,141, 24, 36,  0,  8,130,129,177,  7,105,224,  6,113, 64,  6,218,136, 65,
-		  2,128, 32, 24, 24,124,160,  6,111, 32,  7,104,176,141, 24, 36,  0,  8,130,129,209,  7,107, 64,  7,115,112,  6,220,136, 65,  2,128, 32, 24, 24,126,192,  6,117, 64,  7, 96,208, 13, 71,  8,208,240, 13,
-		 71,  8,209,240,149, 16,232, 44, 67, 32,  4, 35,  6, 15,  0,130, 96,208,128, 66, 38, 69,  5, 65, 81,120,128,  7, 97, 64,141, 38,  4,192,104,130, 16,140, 38, 12,194,104,  2, 49, 24,225,200,199,  8, 71,
-		 62, 70, 56,242, 49,194,145,207, 44,129, 48, 80, 49, 32,  1, 25,  0,  3, 21,  3, 18,144,  1, 48, 80, 49, 32,  1, 25,  0,  3, 21,  3, 18,144,  1, 48, 28, 33,137,  1,241, 13, 71, 72, 99, 64,124, 37,  4,
-		 59,203,128, 12,193,136,193,  2,128, 32, 24, 60,175,  0,  7,220,166,113,155, 54, 98, 96,  0, 32,  8,  6,209, 43,188, 65, 96,129, 39, 31, 19, 60,249,216,224,201,103,196,224,  0, 64, 16, 12,172, 88,160,
-		131, 50,104,131,209,132,  0, 24, 77, 16,130,209,132, 65,176,  1, 13,226, 99,  3, 26,196,199,  6, 52,136,207,136,193,  2,128, 32, 24, 60,187,192,  7,131, 16, 12, 66, 48, 98, 96,  0, 32,  8,  6,209, 46,
-		236, 65, 96, 69, 32, 31, 43,  4,249, 88, 49,200,103,196,224,  0, 64, 16, 12, 50, 94,  0,133, 56,224,131,209,132,  0, 24,110,  8,118,  1, 12,102, 25, 14, 34,152, 37, 40,  6, 42,134,119, 40,220,129, 24,
-		168, 24,226,161,128,  7, 98,160, 98,152,135, 66, 30,136,129, 10, 98, 30, 10,191, 32, 42,224,  5,169,192, 23, 96,196,224,  0, 64, 16, 12, 44,115, 72,  5, 61,  8, 70, 19,  2, 96, 52, 65,  8, 70, 19,  6,
-		 97,196,224,  0, 64, 16, 12, 44,117,104,  5, 63, 48, 70, 19,  2, 96, 52, 65,  8, 70, 19,  6,193,134, 80,136,143, 13,161, 16, 31, 27, 66, 33, 62, 54, 12,242,177, 97,144,143,  9,  1,124,140, 32,228, 99,
-		 66,  0,159, 17,  3,  3,  0, 65, 48,136,240, 33, 22,  2, 11, 32,250,152, 44,  4,241, 25, 49, 48,  0, 16,  4,131,104, 31,220, 33, 24, 49, 88,  0, 16,  4,131,167, 31,124,129, 89, 20,102, 81, 70, 12, 12,
-		  0,  4,193, 32,234,135, 94,  8, 44,112,228, 99,130, 35, 31, 27, 28,249,216, 80,  6,240,177,161, 12,224, 99, 67, 25,192,103,196, 96,  1, 64, 16, 12,158,146, 48,135, 65,  8,  6, 33, 24, 49, 48,  0, 16,
-		  4,131,168, 36,202, 33,176, 34,144,143, 21,130,124,172, 24,228, 51, 98,176,  0, 32,  8,  6,143, 74,172, 67, 30,224,193, 29, 44, 74, 50, 98,112,  0, 32,  8,  6, 83, 74,152, 67,240, 11, 85,  6, 38,  1,
-		 35,  6,  7,  0,130, 96, 96,169, 68, 59,248, 66, 48,154, 16,  0,163,  9, 66, 48,154, 48,  8, 35,  6, 11,  0,130, 96,240,196,132, 60,128,194, 31,248,129,146, 32, 35,  6,  7,  0,130, 96, 48,193, 68, 59,
-		  4,230, 48, 98, 96,  0, 32,  8,  6,145, 76,216, 67, 96,  1, 26,200,103,196,192,  0, 64, 16, 12, 34,154,200,135,192,130,  5, 62, 22,108,242,177,160, 13,224, 99,193, 34, 31, 11,238,  0, 62, 54, 48,242,
-		177,  0, 15,224, 99, 69, 35, 31, 11,242,  0, 62,149,  7, 57,  1, 35,  6,  7,  0,130, 96,144,241,  4, 72,196,  3, 63,140, 38,  4,192,112,195, 16,144,193, 44, 67, 97,  4,179,  4,199, 64,197,224, 30,131,
-		100, 12, 84, 12,240, 49, 64,198, 64,197, 32, 31,131, 99,216,224, 11,242,177,193, 23,228, 99,131, 47,200,103,150,  0, 25,168, 24,140, 67, 52,132,129,138,193, 56, 68, 67, 24,168, 24,140, 67, 52,132, 17,
-		131,  4,  0, 65, 48, 64,220, 66, 37,202,162, 44,114, 98, 24, 49, 72,  0, 16,  4,  3,196, 45, 84,162, 44,202, 34, 38,132, 17,131,  4,  0, 65, 48, 64,220, 66, 37,202,162, 44,112, 34, 24, 49, 72,  0, 16,
-		  4,  3,196, 45, 84,162, 44,202, 98, 39,194,  1,  1,  0,  0,  0,  0,  0,  0,  0,
-	};
-
-	constexpr std::array<uint8_t, 3620> ShaderPsSpirvBytes{
-		  3,  2, 35,  7,  0,  5,  1,  0,  0,  0, 14,  0,137,  0,  0,  0,  0,  0,  0,  0, 17,  0,  2,  0,  1,  0,  0,  0, 11,  0,  6,  0,  1,  0,  0,  0, 71, 76, 83, 76, 46,115,116,100, 46, 52, 53, 48,  0,  0,
-		  0,  0, 14,  0,  3,  0,  0,  0,  0,  0,  1,  0,  0,  0, 15,  0, 13,  0,  4,  0,  0,  0,  2,  0,  0,  0,109, 97,105,110,  0,  0,  0,  0,  3,  0,  0,  0,  4,  0,  0,  0,  5,  0,  0,  0,  6,  0,  0,  0,
-		  7,  0,  0,  0,  8,  0,  0,  0,  9,  0,  0,  0, 10,  0,  0,  0, 16,  0,  3,  0,  2,  0,  0,  0,  7,  0,  0,  0,  3,  0,  3,  0,  5,  0,  0,  0, 88,  2,  0,  0,  5,  0,  6,  0, 11,  0,  0,  0,116,121,
-		112,101, 46, 50,100, 46,105,109, 97,103,101,  0,  0,  0,  5,  0,  4,  0,  8,  0,  0,  0, 84,101,120,116,117,114,101,  0,  5,  0,  6,  0, 12,  0,  0,  0,116,121,112,101, 46,115, 97,109,112,108,101,114,
-		  0,  0,  0,  0,  5,  0,  4,  0,  9,  0,  0,  0, 83, 97,109,112,108,101,114,  0,  5,  0,  6,  0, 13,  0,  0,  0,116,121,112,101, 46, 76,105,103,104,116, 68, 97,116, 97,  0,  0,  6,  0,  5,  0, 13,  0,
-		  0,  0,  0,  0,  0,  0,108,105,103,104,116,115,  0,  0,  6,  0,  6,  0, 13,  0,  0,  0,  1,  0,  0,  0,108,105,103,104,116, 67,111,117,110,116,  0,  0,  6,  0,  6,  0, 13,  0,  0,  0,  2,  0,  0,  0,
-		 99, 97,109,101,114, 97, 80,111,115,  0,  0,  0,  5,  0,  4,  0, 14,  0,  0,  0, 76,105,103,104,116,  0,  0,  0,  6,  0,  6,  0, 14,  0,  0,  0,  0,  0,  0,  0,112,111,115,105,116,105,111,110,  0,  0,
-		  0,  0,  6,  0,  5,  0, 14,  0,  0,  0,  1,  0,  0,  0, 99,111,108,111,114,  0,  0,  0,  6,  0,  5,  0, 14,  0,  0,  0,  2,  0,  0,  0,112, 97,114, 97,109,115,  0,  0,  5,  0,  5,  0, 10,  0,  0,  0,
-		 76,105,103,104,116, 68, 97,116, 97,  0,  0,  0,  5,  0,  7,  0,  3,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 48,  0,  0,  0,  0,  5,  0,  6,  0,  4,  0,  0,  0,105,110,
-		 46,118, 97,114, 46, 67, 79, 76, 79, 82, 48,  0,  0,  0,  5,  0,  7,  0,  5,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 49,  0,  0,  0,  0,  5,  0,  7,  0,  6,  0,  0,  0,
-		105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 50,  0,  0,  0,  0,  5,  0,  7,  0,  7,  0,  0,  0,111,117,116, 46,118, 97,114, 46, 83, 86, 95, 84, 97,114,103,101,116,  0,  0,  0,  5,  0,
-		  4,  0,  2,  0,  0,  0,109, 97,105,110,  0,  0,  0,  0,  5,  0,  7,  0, 15,  0,  0,  0,116,121,112,101, 46,115, 97,109,112,108,101,100, 46,105,109, 97,103,101,  0,  0, 71,  0,  4,  0,  3,  0,  0,  0,
-		 30,  0,  0,  0,  0,  0,  0,  0, 71,  0,  4,  0,  4,  0,  0,  0, 30,  0,  0,  0,  1,  0,  0,  0, 71,  0,  4,  0,  5,  0,  0,  0, 30,  0,  0,  0,  2,  0,  0,  0, 71,  0,  4,  0,  6,  0,  0,  0, 30,  0,
-		  0,  0,  3,  0,  0,  0, 71,  0,  4,  0,  7,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 71,  0,  4,  0,  8,  0,  0,  0, 34,  0,  0,  0,  2,  0,  0,  0, 71,  0,  4,  0,  8,  0,  0,  0, 33,  0,  0,  0,
-		  0,  0,  0,  0, 71,  0,  4,  0,  9,  0,  0,  0, 34,  0,  0,  0,  2,  0,  0,  0, 71,  0,  4,  0,  9,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0, 71,  0,  4,  0, 10,  0,  0,  0, 34,  0,  0,  0,  3,  0,
-		  0,  0, 71,  0,  4,  0, 10,  0,  0,  0, 33,  0,  0,  0,  0,  0,  0,  0, 72,  0,  5,  0, 14,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 72,  0,  5,  0, 14,  0,  0,  0,  1,  0,  0,  0,
-		 35,  0,  0,  0, 16,  0,  0,  0, 72,  0,  5,  0, 14,  0,  0,  0,  2,  0,  0,  0, 35,  0,  0,  0, 32,  0,  0,  0, 71,  0,  4,  0, 16,  0,  0,  0,  6,  0,  0,  0, 48,  0,  0,  0, 72,  0,  5,  0, 13,  0,
-		  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 72,  0,  5,  0, 13,  0,  0,  0,  1,  0,  0,  0, 35,  0,  0,  0,192,  0,  0,  0, 72,  0,  5,  0, 13,  0,  0,  0,  2,  0,  0,  0, 35,  0,  0,  0,
-		208,  0,  0,  0, 71,  0,  3,  0, 13,  0,  0,  0,  2,  0,  0,  0, 21,  0,  4,  0, 17,  0,  0,  0, 32,  0,  0,  0,  1,  0,  0,  0, 43,  0,  4,  0, 17,  0,  0,  0, 18,  0,  0,  0,  1,  0,  0,  0, 43,  0,
-		  4,  0, 17,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0, 22,  0,  3,  0, 20,  0,  0,  0, 32,  0,  0,  0, 43,  0,  4,  0, 20,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0, 20,  0,  2,  0, 22,  0,  0,  0,
-		 42,  0,  3,  0, 22,  0,  0,  0, 23,  0,  0,  0, 43,  0,  4,  0, 17,  0,  0,  0, 24,  0,  0,  0,  2,  0,  0,  0, 43,  0,  4,  0, 20,  0,  0,  0, 25,  0,  0,  0,  0,  0,192,191, 41,  0,  3,  0, 22,  0,
-		  0,  0, 26,  0,  0,  0, 23,  0,  4,  0, 27,  0,  0,  0, 20,  0,  0,  0,  3,  0,  0,  0, 44,  0,  6,  0, 27,  0,  0,  0, 28,  0,  0,  0, 21,  0,  0,  0, 21,  0,  0,  0, 21,  0,  0,  0, 21,  0,  4,  0,
-		 29,  0,  0,  0, 32,  0,  0,  0,  0,  0,  0,  0, 43,  0,  4,  0, 29,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 43,  0,  4,  0, 20,  0,  0,  0, 31,  0,  0,  0,  0,  0,128, 63, 43,  0,  4,  0, 29,  0,
-		  0,  0, 32,  0,  0,  0,  1,  0,  0,  0, 25,  0,  9,  0, 11,  0,  0,  0, 20,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 32,  0,  4,  0,
-		 33,  0,  0,  0,  0,  0,  0,  0, 11,  0,  0,  0, 26,  0,  2,  0, 12,  0,  0,  0, 32,  0,  4,  0, 34,  0,  0,  0,  0,  0,  0,  0, 12,  0,  0,  0, 43,  0,  4,  0, 29,  0,  0,  0, 35,  0,  0,  0,  4,  0,
-		  0,  0, 23,  0,  4,  0, 36,  0,  0,  0, 20,  0,  0,  0,  4,  0,  0,  0, 30,  0,  5,  0, 14,  0,  0,  0, 36,  0,  0,  0, 36,  0,  0,  0, 36,  0,  0,  0, 28,  0,  4,  0, 16,  0,  0,  0, 14,  0,  0,  0,
-		 35,  0,  0,  0, 30,  0,  5,  0, 13,  0,  0,  0, 16,  0,  0,  0, 29,  0,  0,  0, 36,  0,  0,  0, 32,  0,  4,  0, 37,  0,  0,  0,  2,  0,  0,  0, 13,  0,  0,  0, 32,  0,  4,  0, 38,  0,  0,  0,  1,  0,
-		  0,  0, 36,  0,  0,  0, 23,  0,  4,  0, 39,  0,  0,  0, 20,  0,  0,  0,  2,  0,  0,  0, 32,  0,  4,  0, 40,  0,  0,  0,  1,  0,  0,  0, 39,  0,  0,  0, 32,  0,  4,  0, 41,  0,  0,  0,  1,  0,  0,  0,
-		 27,  0,  0,  0, 32,  0,  4,  0, 42,  0,  0,  0,  3,  0,  0,  0, 36,  0,  0,  0, 19,  0,  2,  0, 43,  0,  0,  0, 33,  0,  3,  0, 44,  0,  0,  0, 43,  0,  0,  0, 27,  0,  3,  0, 15,  0,  0,  0, 11,  0,
-		  0,  0, 32,  0,  4,  0, 45,  0,  0,  0,  2,  0,  0,  0, 36,  0,  0,  0, 32,  0,  4,  0, 46,  0,  0,  0,  2,  0,  0,  0, 29,  0,  0,  0, 32,  0,  4,  0, 47,  0,  0,  0,  2,  0,  0,  0, 14,  0,  0,  0,
-		 59,  0,  4,  0, 33,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0, 59,  0,  4,  0, 34,  0,  0,  0,  9,  0,  0,  0,  0,  0,  0,  0, 59,  0,  4,  0, 37,  0,  0,  0, 10,  0,  0,  0,  2,  0,  0,  0, 59,  0,
-		  4,  0, 40,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 38,  0,  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 41,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0,
-		 41,  0,  0,  0,  6,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 42,  0,  0,  0,  7,  0,  0,  0,  3,  0,  0,  0, 54,  0,  5,  0, 43,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,  0,248,  0,
-		  2,  0, 48,  0,  0,  0, 61,  0,  4,  0, 39,  0,  0,  0, 49,  0,  0,  0,  3,  0,  0,  0, 61,  0,  4,  0, 36,  0,  0,  0, 50,  0,  0,  0,  4,  0,  0,  0, 61,  0,  4,  0, 27,  0,  0,  0, 51,  0,  0,  0,
-		  5,  0,  0,  0, 61,  0,  4,  0, 27,  0,  0,  0, 52,  0,  0,  0,  6,  0,  0,  0,247,  0,  3,  0, 53,  0,  0,  0,  0,  0,  0,  0,251,  0,  3,  0, 30,  0,  0,  0, 54,  0,  0,  0,248,  0,  2,  0, 54,  0,
-		  0,  0, 81,  0,  5,  0, 20,  0,  0,  0, 55,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,190,  0,  5,  0, 22,  0,  0,  0, 56,  0,  0,  0, 55,  0,  0,  0, 21,  0,  0,  0,247,  0,  3,  0, 57,  0,  0,  0,
-		  0,  0,  0,  0,250,  0,  4,  0, 56,  0,  0,  0, 58,  0,  0,  0, 57,  0,  0,  0,248,  0,  2,  0, 58,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0, 59,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,190,  0,
-		  5,  0, 22,  0,  0,  0, 60,  0,  0,  0, 59,  0,  0,  0, 21,  0,  0,  0,249,  0,  2,  0, 57,  0,  0,  0,248,  0,  2,  0, 57,  0,  0,  0,245,  0,  7,  0, 22,  0,  0,  0, 61,  0,  0,  0, 23,  0,  0,  0,
-		 54,  0,  0,  0, 60,  0,  0,  0, 58,  0,  0,  0,247,  0,  3,  0, 62,  0,  0,  0,  0,  0,  0,  0,250,  0,  4,  0, 61,  0,  0,  0, 63,  0,  0,  0, 64,  0,  0,  0,248,  0,  2,  0, 63,  0,  0,  0, 61,  0,
-		  4,  0, 11,  0,  0,  0, 65,  0,  0,  0,  8,  0,  0,  0, 61,  0,  4,  0, 12,  0,  0,  0, 66,  0,  0,  0,  9,  0,  0,  0, 86,  0,  5,  0, 15,  0,  0,  0, 67,  0,  0,  0, 65,  0,  0,  0, 66,  0,  0,  0,
-		 87,  0,  6,  0, 36,  0,  0,  0, 68,  0,  0,  0, 67,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,133,  0,  5,  0, 36,  0,  0,  0, 69,  0,  0,  0, 68,  0,  0,  0, 50,  0,  0,  0,249,  0,  2,  0, 62,  0,
-		  0,  0,248,  0,  2,  0, 64,  0,  0,  0,249,  0,  2,  0, 62,  0,  0,  0,248,  0,  2,  0, 62,  0,  0,  0,245,  0,  7,  0, 36,  0,  0,  0, 70,  0,  0,  0, 69,  0,  0,  0, 63,  0,  0,  0, 50,  0,  0,  0,
-		 64,  0,  0,  0,184,  0,  5,  0, 22,  0,  0,  0, 71,  0,  0,  0, 55,  0,  0,  0, 25,  0,  0,  0,168,  0,  4,  0, 22,  0,  0,  0, 72,  0,  0,  0, 71,  0,  0,  0,247,  0,  3,  0, 73,  0,  0,  0,  0,  0,
-		  0,  0,250,  0,  4,  0, 72,  0,  0,  0, 74,  0,  0,  0, 73,  0,  0,  0,248,  0,  2,  0, 74,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0, 75,  0,  0,  0, 49,  0,  0,  0,  1,  0,  0,  0,184,  0,  5,  0,
-		 22,  0,  0,  0, 76,  0,  0,  0, 75,  0,  0,  0, 25,  0,  0,  0,249,  0,  2,  0, 73,  0,  0,  0,248,  0,  2,  0, 73,  0,  0,  0,245,  0,  7,  0, 22,  0,  0,  0, 77,  0,  0,  0, 26,  0,  0,  0, 62,  0,
-		  0,  0, 76,  0,  0,  0, 74,  0,  0,  0,247,  0,  3,  0, 78,  0,  0,  0,  0,  0,  0,  0,250,  0,  4,  0, 77,  0,  0,  0, 79,  0,  0,  0, 78,  0,  0,  0,248,  0,  2,  0, 79,  0,  0,  0,249,  0,  2,  0,
-		 53,  0,  0,  0,248,  0,  2,  0, 78,  0,  0,  0, 12,  0,  6,  0, 27,  0,  0,  0, 80,  0,  0,  0,  1,  0,  0,  0, 69,  0,  0,  0, 51,  0,  0,  0, 65,  0,  5,  0, 45,  0,  0,  0, 81,  0,  0,  0, 10,  0,
-		  0,  0, 24,  0,  0,  0, 61,  0,  4,  0, 36,  0,  0,  0, 82,  0,  0,  0, 81,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0, 83,  0,  0,  0, 82,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,
-		 84,  0,  0,  0, 82,  0,  0,  0,  1,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0, 85,  0,  0,  0, 82,  0,  0,  0,  2,  0,  0,  0, 80,  0,  6,  0, 27,  0,  0,  0, 86,  0,  0,  0, 83,  0,  0,  0, 84,  0,
-		  0,  0, 85,  0,  0,  0,131,  0,  5,  0, 27,  0,  0,  0, 87,  0,  0,  0, 86,  0,  0,  0, 52,  0,  0,  0, 12,  0,  6,  0, 27,  0,  0,  0, 88,  0,  0,  0,  1,  0,  0,  0, 69,  0,  0,  0, 87,  0,  0,  0,
-		249,  0,  2,  0, 89,  0,  0,  0,248,  0,  2,  0, 89,  0,  0,  0,245,  0,  7,  0, 27,  0,  0,  0, 90,  0,  0,  0, 28,  0,  0,  0, 78,  0,  0,  0, 91,  0,  0,  0, 92,  0,  0,  0,245,  0,  7,  0, 29,  0,
-		  0,  0, 93,  0,  0,  0, 30,  0,  0,  0, 78,  0,  0,  0, 94,  0,  0,  0, 92,  0,  0,  0, 65,  0,  5,  0, 46,  0,  0,  0, 95,  0,  0,  0, 10,  0,  0,  0, 18,  0,  0,  0, 61,  0,  4,  0, 29,  0,  0,  0,
-		 96,  0,  0,  0, 95,  0,  0,  0,176,  0,  5,  0, 22,  0,  0,  0, 97,  0,  0,  0, 93,  0,  0,  0, 96,  0,  0,  0,246,  0,  4,  0, 98,  0,  0,  0, 92,  0,  0,  0,  0,  0,  0,  0,250,  0,  4,  0, 97,  0,
-		  0,  0, 92,  0,  0,  0, 98,  0,  0,  0,248,  0,  2,  0, 92,  0,  0,  0, 65,  0,  6,  0, 47,  0,  0,  0, 99,  0,  0,  0, 10,  0,  0,  0, 19,  0,  0,  0, 93,  0,  0,  0, 61,  0,  4,  0, 14,  0,  0,  0,
-		100,  0,  0,  0, 99,  0,  0,  0, 81,  0,  5,  0, 36,  0,  0,  0,101,  0,  0,  0,100,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 36,  0,  0,  0,102,  0,  0,  0,100,  0,  0,  0,  1,  0,  0,  0, 81,  0,
-		  5,  0, 36,  0,  0,  0,103,  0,  0,  0,100,  0,  0,  0,  2,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,104,  0,  0,  0,103,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,105,  0,  0,  0,
-		103,  0,  0,  0,  1,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,106,  0,  0,  0,103,  0,  0,  0,  2,  0,  0,  0, 79,  0,  8,  0, 27,  0,  0,  0,107,  0,  0,  0,101,  0,  0,  0,101,  0,  0,  0,  0,  0,
-		  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,131,  0,  5,  0, 27,  0,  0,  0,108,  0,  0,  0,107,  0,  0,  0, 52,  0,  0,  0, 12,  0,  6,  0, 20,  0,  0,  0,109,  0,  0,  0,  1,  0,  0,  0, 66,  0,  0,  0,
-		108,  0,  0,  0,136,  0,  5,  0, 20,  0,  0,  0,110,  0,  0,  0,109,  0,  0,  0,104,  0,  0,  0,131,  0,  5,  0, 20,  0,  0,  0,111,  0,  0,  0, 31,  0,  0,  0,110,  0,  0,  0, 12,  0,  8,  0, 20,  0,
-		  0,  0,112,  0,  0,  0,  1,  0,  0,  0, 43,  0,  0,  0,111,  0,  0,  0, 21,  0,  0,  0, 31,  0,  0,  0, 12,  0,  6,  0, 27,  0,  0,  0,113,  0,  0,  0,  1,  0,  0,  0, 69,  0,  0,  0,108,  0,  0,  0,
-		129,  0,  5,  0, 27,  0,  0,  0,114,  0,  0,  0,113,  0,  0,  0, 88,  0,  0,  0, 12,  0,  6,  0, 27,  0,  0,  0,115,  0,  0,  0,  1,  0,  0,  0, 69,  0,  0,  0,114,  0,  0,  0,148,  0,  5,  0, 20,  0,
-		  0,  0,116,  0,  0,  0, 80,  0,  0,  0,113,  0,  0,  0, 12,  0,  7,  0, 20,  0,  0,  0,117,  0,  0,  0,  1,  0,  0,  0, 80,  0,  0,  0,116,  0,  0,  0, 21,  0,  0,  0, 79,  0,  8,  0, 27,  0,  0,  0,
-		118,  0,  0,  0,102,  0,  0,  0,102,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,142,  0,  5,  0, 27,  0,  0,  0,119,  0,  0,  0,118,  0,  0,  0,117,  0,  0,  0,142,  0,  5,  0, 27,  0,
-		  0,  0,120,  0,  0,  0,119,  0,  0,  0,112,  0,  0,  0,148,  0,  5,  0, 20,  0,  0,  0,121,  0,  0,  0, 80,  0,  0,  0,115,  0,  0,  0, 12,  0,  7,  0, 20,  0,  0,  0,122,  0,  0,  0,  1,  0,  0,  0,
-		 80,  0,  0,  0,121,  0,  0,  0, 21,  0,  0,  0, 12,  0,  7,  0, 20,  0,  0,  0,123,  0,  0,  0,  1,  0,  0,  0, 26,  0,  0,  0,122,  0,  0,  0,106,  0,  0,  0,142,  0,  5,  0, 27,  0,  0,  0,124,  0,
-		  0,  0,118,  0,  0,  0,123,  0,  0,  0,142,  0,  5,  0, 27,  0,  0,  0,125,  0,  0,  0,124,  0,  0,  0,112,  0,  0,  0,142,  0,  5,  0, 27,  0,  0,  0,126,  0,  0,  0,118,  0,  0,  0,105,  0,  0,  0,
-		129,  0,  5,  0, 27,  0,  0,  0,127,  0,  0,  0,126,  0,  0,  0,120,  0,  0,  0,129,  0,  5,  0, 27,  0,  0,  0,128,  0,  0,  0,127,  0,  0,  0,125,  0,  0,  0,129,  0,  5,  0, 27,  0,  0,  0, 91,  0,
-		  0,  0, 90,  0,  0,  0,128,  0,  0,  0,128,  0,  5,  0, 29,  0,  0,  0, 94,  0,  0,  0, 93,  0,  0,  0, 32,  0,  0,  0,249,  0,  2,  0, 89,  0,  0,  0,248,  0,  2,  0, 98,  0,  0,  0, 79,  0,  8,  0,
-		 27,  0,  0,  0,129,  0,  0,  0, 70,  0,  0,  0, 70,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,133,  0,  5,  0, 27,  0,  0,  0,130,  0,  0,  0,129,  0,  0,  0, 90,  0,  0,  0, 81,  0,
-		  5,  0, 20,  0,  0,  0,131,  0,  0,  0, 70,  0,  0,  0,  3,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,132,  0,  0,  0,130,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,133,  0,  0,  0,
-		130,  0,  0,  0,  1,  0,  0,  0, 81,  0,  5,  0, 20,  0,  0,  0,134,  0,  0,  0,130,  0,  0,  0,  2,  0,  0,  0, 80,  0,  7,  0, 36,  0,  0,  0,135,  0,  0,  0,132,  0,  0,  0,133,  0,  0,  0,134,  0,
-		  0,  0,131,  0,  0,  0,249,  0,  2,  0, 53,  0,  0,  0,248,  0,  2,  0, 53,  0,  0,  0,245,  0,  7,  0, 36,  0,  0,  0,136,  0,  0,  0, 70,  0,  0,  0, 79,  0,  0,  0,135,  0,  0,  0, 98,  0,  0,  0,
-		 62,  0,  3,  0,  7,  0,  0,  0,136,  0,  0,  0,253,  0,  1,  0, 56,  0,  1,  0,
-	};
-
-}
-
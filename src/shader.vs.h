@@ -1,155 +0,0 @@
-#pragma once
-
-// Generated by compile_shaders.py. Do not edit manually.
-#include <SDL3/SDL_gpu.h>
-
-#include <cstdint>
-#include <array>
-
-namespace robot {
-
-	constexpr std::array<uint8_t, 4952> ShaderVsDxilBytes{
-		 68, 88, 66, 67,102,233, 33,196,189,157,121,150,141,170,109,166,216,148,253, 82,  1,  0,  0,  0, 88, 19,  0,  0,  7,  0,  0,  0, 60,  0,  0,  0, 76,  0,  0,  0,232,  0,  0,  0,180,  1,  0,  0, 76,  3,
-		  0,  0, 56, 10,  0,  0, 84, 10,  0,  0, 83, 70, 73, 48,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 73, 83, 71, 49,148,  0,  0,  0,  4,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,
-		  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0,  3,  3,
-		  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  2,  0,  0,  0, 15, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,136,  0,  0,  0,  3,  0,  0,  0,
-		  0,  0,  0,  0,  3,  0,  0,  0,  3,  0,  0,  0,  7,  7,  0,  0,  0,  0,  0,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0,  0,  0,  0, 79, 83, 71, 49,196,  0,  0,  0,  5,  0,  0,  0,  8,  0,  0,  0,  0,  0,
-		  0,  0,168,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,
-		  1,  0,  0,  0,  3, 12,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,189,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  2,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,
-		  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  3,  0,  0,  0,  7,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,180,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  4,  0,  0,  0,
-		  7,  8,  0,  0,  0,  0,  0,  0, 83, 86, 95, 80,111,115,105,116,105,111,110,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 67, 79, 76, 79, 82,  0,  0, 80, 83, 86, 48,144,  1,  0,  0, 52,  0,  0,  0,  1,  0,
-		  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,  1,  0,  0,  0,  4,  5,  0,  4,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 70,  0,  0,  0,
-		  1,  0,  0,  0, 24,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 76,  0,  0,  0,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 84, 69, 88, 67,
-		 79, 79, 82, 68,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 67, 79, 76, 79, 82,  0, 84, 69, 88, 67, 79, 79, 82, 68,  0, 84, 69, 88,
-		 67, 79, 79, 82, 68,  0,109, 97,105,110,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0, 16,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0, 67,  0,  3,  0,
-		  0,  0, 10,  0,  0,  0,  1,  0,  0,  0,  1,  1, 66,  0,  3,  0,  0,  0, 19,  0,  0,  0,  2,  0,  0,  0,  1,  2, 68,  0,  3,  0,  0,  0, 28,  0,  0,  0,  3,  0,  0,  0,  1,  3, 67,  0,  3,  0,  0,  0,
-		  0,  0,  0,  0,  0,  0,  0,  0,  1,  0, 68,  3,  3,  4,  0,  0, 37,  0,  0,  0,  0,  0,  0,  0,  1,  1, 66,  0,  3,  2,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  1,  2, 68,  0,  3,  2,  0,  0, 52,  0,
-		  0,  0,  1,  0,  0,  0,  1,  3, 67,  0,  3,  2,  0,  0, 61,  0,  0,  0,  2,  0,  0,  0,  1,  4, 67,  0,  3,  2,  0,  0, 15,  0,  1,  0, 15,  0,  2,  0, 15,  0,  4,  0,  0,  0,  0,  0, 31,  0,  0,  0,
-		 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  2,  0,  0,  0,  4,  0,  0,  0,  8,  0,  0,  0, 16,  0,  0,  0, 32,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0, 83, 84, 65, 84,228,  6,
-		  0,  0, 96,  0,  1,  0,185,  1,  0,  0, 68, 88, 73, 76,  0,  1,  0,  0, 16,  0,  0,  0,204,  6,  0,  0, 66, 67,192,222, 33, 12,  0,  0,176,  1,  0,  0, 11,130, 32,  0,  2,  0,  0,  0, 19,  0,  0,  0,
-		  7,129, 35,145, 65,200,  4, 73,  6, 16, 50, 57,146,  1,132, 12, 37,  5,  8, 25, 30,  4,139, 98,128, 20, 69,  2, 66,146, 11, 66,164, 16, 50, 20, 56,  8, 24, 75, 10, 50, 82,136, 72,144, 20, 32, 67, 70,
-		136,165,  0, 25, 50, 66,228, 72, 14,144,145, 34,196, 80, 65, 81,129,140,225,131,229,138,  4, 41, 70,  6, 81, 24,  0,  0,  8,  0,  0,  0, 27,140,224,255,255,255,255,  7, 64,  2,168, 13,132,240,255,255,
-		255,255,  3, 32,109, 48,134,255,255,255,255, 31,  0,  9,168,  0, 73, 24,  0,  0,  3,  0,  0,  0, 19,130, 96, 66, 32, 76,  8,  6,  0,  0,  0,  0,137, 32,  0,  0, 37,  0,  0,  0, 50, 34, 72,  9, 32,100,
-		133,  4,147, 34,164,132,  4,147, 34,227,132,161,144, 20, 18, 76,138,140, 11,132,164, 76, 16,104, 35,  0, 37,  0, 20,102,  0,230,  8,192, 96,142,  0, 41,198, 32,132, 20, 66,166, 24,128, 16, 82,  6,161,
-		163,134,203,159,176,135,144,124,110,163,138,149,152,252,226,182, 17, 49,198, 24, 84,238, 25, 46,127,194, 30, 66,242, 67,160, 25, 22,  2,  5,171, 16,138, 48, 66,173, 20,131,140, 49,232,205, 17,  4,197,
-		 96,164, 16, 18, 73, 14,  4, 12, 35, 16, 67, 18,212,203, 14, 71,154, 22,  0,115,168,201,127,137,104, 34, 46,183, 65, 10, 39, 98, 36, 20, 88,186, 25, 65,  0,  0,  0,  0, 19, 20,114,192,135,116, 96,135,
-		 54,104,135,121,104,  3,114,192,135, 13,175, 80, 14,109,208, 14,122, 80, 14,109,  0, 15,122, 48,  7,114,160,  7,115, 32,  7,109,144, 14,113,160,  7,115, 32,  7,109,144, 14,120,160,  7,115, 32,  7,109,
-		144, 14,113, 96,  7,122, 48,  7,114,208,  6,233, 48,  7,114,160,  7,115, 32,  7,109,144, 14,118, 64,  7,122, 96,  7,116,208,  6,230, 16,  7,118,160,  7,115, 32,  7,109, 96, 14,115, 32,  7,122, 48,  7,
-		114,208,  6,230, 96,  7,116,160,  7,118, 64,  7,109,224, 14,120,160,  7,113, 96,  7,122, 48,  7,114,160,  7,118, 64,  7, 67,158,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,134, 60,  6, 16,  0,  1,  0,
-		  0,  0,  0,  0,  0,  0, 12,121, 16, 32,  0,  4,  0,  0,  0,  0,  0,  0,  0, 24,242, 52, 64,  0, 12,  0,  0,  0,  0,  0,  0,  0, 48,228,121,128,  0,  8,  0,  0,  0,  0,  0,  0,  0, 96,200, 35,  1,  1,
-		 48,  0,  0,  0,  0,  0,  0,  0, 64, 22,  8,  0, 22,  0,  0,  0, 50, 30,152, 20, 25, 17, 76,144,140,  9, 38, 71,198,  4, 67, 34, 37, 48,  2, 80, 12,  5, 24, 80,  4,133, 80,  6,229, 80, 18,229, 81, 20,
-		101, 25, 80, 24,  5, 66,165, 36, 70,  0,202,160,  8, 10,129,238, 12,  0,225, 25,  0,202, 99, 69,207,244,130,160,240,130, 32,241,130, 32,  2,124,111,  0,  0, 32,  2, 66, 32, 24,128,160,  0,130,  4,  8,
-		 34, 32,  8,  1,121, 24,  0,  0,166,  0,  0,  0, 26,  3, 76,144, 70,  2, 19,196, 49, 32,195, 27, 67,129,147, 75,179, 11,163, 43, 75,  1,137,113,193,113,129,113,161,201,129,185,  1, 65,129,177,153,193,
-		137, 49,147, 33,187, 73,217, 16,  4, 19,  4,194,152, 32, 16,199,  6, 97, 32, 54,  8,  4, 65,193,110,110,130, 64, 32, 27,134,  3, 33, 38,  8,152, 70,199,170, 76,142,174, 12,175,202, 45,205,236, 77,174,
-		109,110,130, 64, 36, 27, 16, 66, 89,  6, 98, 96,128, 13, 65,179,129,  0,  0,  7,152, 32, 92, 25, 33, 56,185, 55,181,178, 49,186,180, 55,183,166, 48, 58,185, 52,188,  9,  2,161, 76, 16,136,101,195, 48,
-		 77,210,  4,129, 96, 38,  8, 68, 51, 65, 32,156, 13,  8, 18, 73, 84, 69, 88,215,  6,129,193, 54, 12,  4,148, 77, 16,  4, 96,  3,176, 97, 32, 56,110, 67,208,109, 24,134,205,155, 32,100,219,134,  0, 12,
-		 72,180,133,165,185, 17,161, 42,194, 26,122,122,146, 34,154, 32, 20,212,  4,161,168, 54,  4,196,  4,161,176, 54,  8,149,181, 97, 33,198,128, 12,202,192, 12,202, 96, 56,  3,162, 12,208, 96, 67, 48, 76,
-		 16,138,107,131, 80, 85, 27,150, 97, 12,200,160, 12,212,160, 12,134, 53, 24,202,128, 13, 54,  4,210,  4,161,192, 38,  8,196,179, 65,168,224, 96,195, 34,141,  1, 25,148,129, 27,148,193,240,  6, 82, 25,
-		196,193,134,160,218,176, 84, 99, 64,  6,101, 48,  7,101, 48,156, 65, 85,  6,104,176,129, 72,131, 54,144,  3, 58,224, 50,101,245,  5,245, 54,151, 70,151,246,230,182, 97, 33,236,128, 12,206,192, 12,222,
-		 96,120,  3,162, 12,226, 96,195, 50,140,  1, 25,148,129, 25,172,193,176,  6, 67, 25,176,  1,139,161, 39,166, 39,169, 13,139,148,  7,100, 80,  6,102,176,  6,195, 27, 72,101, 16,  7, 27,150,106, 12,200,
-		160, 12,212, 96, 13,134, 51,168,202,  0, 13, 54, 44,211, 24,144, 65, 25,184,193, 26, 12,103, 48,149,  1, 26,108, 40,238,  0, 15,244, 96, 15,248, 96,195, 80,  7,125,  0,108, 40, 54, 49,240,131,  7, 32,
-		 34, 38, 23,230, 54,134, 86, 54, 71,195,140,237, 45,140,110,110,130, 64, 64, 44,210,220,230,232,230, 38,  8, 68, 68, 99, 46,237,236,139,141,108,130, 64, 72, 52,230,210,206,190,230,232, 38,  8,196,196,
-		162, 46,205,141,110,110,  3,  3, 10, 67, 40,136,194, 40,144, 66, 41,152,194, 41,160, 66, 42, 12, 85,216,216,236,218, 92,210,200,202,220,232,166,  4, 65, 21, 50, 60, 23,187, 50,185,185,180, 55,183, 41,
-		  1,209,132, 12,207,197, 46,140,205,174, 76,110, 74, 80,212, 33,195,115,153, 67, 11, 35, 43,147,107,122, 35, 43, 99,155, 18, 32,101,200,240, 92,228,202,230,222,234,228,198,202,230,166,  4, 78, 37, 50,
-		 60, 23,186, 60,184,178, 32, 55,183, 55,186, 48,186,180, 55,183,185, 41, 66,230,213, 33,195,115,177, 75, 43,187, 75, 34,155,162, 11,163, 43,155, 18,128, 65, 29, 50, 60,151, 50, 55, 58,185, 60,168,183,
-		 52, 55,186,185, 41,129, 31,116, 33,195,115, 25,123,171,115,163, 43,147,155,155, 18,164,  2,  0,  0,  0,121, 24,  0,  0, 81,  0,  0,  0, 51,  8,128, 28,196,225, 28,102, 20,  1, 61,136, 67, 56,132,195,
-		140, 66,128,  7,121,120,  7,115,152,113, 12,230,  0, 15,237, 16, 14,244,128, 14, 51, 12, 66, 30,194,193, 29,206,161, 28,102, 48,  5, 61,136, 67, 56,132,131, 27,204,  3, 61,200, 67, 61,140,  3, 61,204,
-		120,140,116,112,  7,123,  8,  7,121, 72,135,112,112,  7,122,112,  3,118,120,135,112, 32,135, 25,204, 17, 14,236,144, 14,225, 48, 15,110, 48, 15,227,240, 14,240, 80, 14, 51, 16,196, 29,222, 33, 28,216,
-		 33, 29,194, 97, 30,102, 48,137, 59,188,131, 59,208, 67, 57,180,  3, 60,188,131, 60,132,  3, 59,204,240, 20,118, 96,  7,123,104,  7, 55,104,135,114,104,  7, 55,128,135,112,144,135,112, 96,  7,118, 40,
-		  7,118,248,  5,118,120,135,119,128,135, 95,  8,135,113, 24,135,114,152,135,121,152,129, 44,238,240, 14,238,224, 14,245,192, 14,236, 48,  3, 98,200,161, 28,228,161, 28,204,161, 28,228,161, 28,220, 97,
-		 28,202, 33, 28,196,129, 29,202, 97,  6,214,144, 67, 57,200, 67, 57,152, 67, 57,200, 67, 57,184,195, 56,148, 67, 56,136,  3, 59,148,195, 47,188,131, 60,252,130, 59,212,  3, 59,176,195,140,200, 33,  7,
-		124,112,  3,114, 16,135,115,112,  3,123,  8,  7,121, 96,135,112,200,135,119,168,  7,122,152,129, 60,228,128, 15,110, 64, 15,229,208, 14,240, 48,131,129,200,  1, 31,220, 64, 28,228,161, 28,194, 97, 29,
-		220, 64, 28,228,  1,  0,  0,  0,113, 32,  0,  0, 24,  0,  0,  0, 54,176, 13,151,239, 60,190, 16, 80, 69, 65, 68,165,  3, 12, 37, 97,  0,  2,230, 23,183,109,  5,210,112,249,206,227, 11, 17,  1, 76, 68,
-		  8, 52,195, 66, 88,192, 52, 92,190,243,248,139,  3, 12, 98,243, 80,147, 95,220,182,  9, 84,195,229, 59,143, 47, 77, 78, 68,160,212,244, 80,147, 95,220,182, 17, 72,195,229, 59,143, 63, 17,209,132,  0,
-		 17,230, 23,183,109,  0,  4,  3, 32, 13,  0,  0,  0,  0,  0,  0, 72, 65, 83, 72, 20,  0,  0,  0,  0,  0,  0,  0, 97,172,242,233,237,147,180,238,123, 78,160,198,146,246,195,229, 68, 88, 73, 76,252,  8,
-		  0,  0, 96,  0,  1,  0, 63,  2,  0,  0, 68, 88, 73, 76,  0,  1,  0,  0, 16,  0,  0,  0,228,  8,  0,  0, 66, 67,192,222, 33, 12,  0,  0, 54,  2,  0,  0, 11,130, 32,  0,  2,  0,  0,  0, 19,  0,  0,  0,
-		  7,129, 35,145, 65,200,  4, 73,  6, 16, 50, 57,146,  1,132, 12, 37,  5,  8, 25, 30,  4,139, 98,128, 20, 69,  2, 66,146, 11, 66,164, 16, 50, 20, 56,  8, 24, 75, 10, 50, 82,136, 72,144, 20, 32, 67, 70,
-		136,165,  0, 25, 50, 66,228, 72, 14,144,145, 34,196, 80, 65, 81,129,140,225,131,229,138,  4, 41, 70,  6, 81, 24,  0,  0,  8,  0,  0,  0, 27,140,224,255,255,255,255,  7, 64,  2,168, 13,132,240,255,255,
-		255,255,  3, 32,109, 48,134,255,255,255,255, 31,  0,  9,168,  0, 73, 24,  0,  0,  3,  0,  0,  0, 19,130, 96, 66, 32, 76,  8,  6,  0,  0,  0,  0,137, 32,  0,  0, 37,  0,  0,  0, 50, 34, 72,  9, 32,100,
-		133,  4,147, 34,164,132,  4,147, 34,227,132,161,144, 20, 18, 76,138,140, 11,132,164, 76, 16,108, 35,  0, 37,  0, 20,102,  0,230,  8,192, 96,142,  0, 41,198, 32,132, 20, 66,166, 24,128, 16, 82,  6,161,
-		163,134,203,159,176,135,144,124,110,163,138,149,152,252,226,182, 17, 49,198, 24, 84,238, 25, 46,127,194, 30, 66,242, 67,160, 25, 22,  2,  5,171, 16,138, 48, 66,173, 20,131,140, 49,232,205, 17,  4,197,
-		 96,164, 16, 18, 73, 14,  4, 12, 35, 16, 67, 18,212,203, 14, 71,154, 22,  0,115,168,201,127,137,104, 34, 46,183, 65, 10, 39, 98, 36, 20, 88,186, 25, 65,166,  0,  0,  0, 19, 20,114,192,135,116, 96,135,
-		 54,104,135,121,104,  3,114,192,135, 13,175, 80, 14,109,208, 14,122, 80, 14,109,  0, 15,122, 48,  7,114,160,  7,115, 32,  7,109,144, 14,113,160,  7,115, 32,  7,109,144, 14,120,160,  7,115, 32,  7,109,
-		144, 14,113, 96,  7,122, 48,  7,114,208,  6,233, 48,  7,114,160,  7,115, 32,  7,109,144, 14,118, 64,  7,122, 96,  7,116,208,  6,230, 16,  7,118,160,  7,115, 32,  7,109, 96, 14,115, 32,  7,122, 48,  7,
-		114,208,  6,230, 96,  7,116,160,  7,118, 64,  7,109,224, 14,120,160,  7,113, 96,  7,122, 48,  7,114,160,  7,118, 64,  7, 67,158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,134, 60,  6, 16,  0,  1,  0,
-		  0,  0,  0,  0,  0,  0, 12,121, 16, 32,  0,  4,  0,  0,  0,  0,  0,  0,  0, 24,242, 52, 64,  0, 12,  0,  0,  0,  0,  0,  0,  0, 48,228,121,128,  0,  8,  0,  0,  0,  0,  0,  0,  0, 96,200, 35,  1,  1,
-		 48,  0,  0,  0,  0,  0,  0,  0, 64, 22,  8,  0, 20,  0,  0,  0, 50, 30,152, 20, 25, 17, 76,144,140,  9, 38, 71,198,  4, 67, 34, 37, 48,  2, 80, 18,197, 80,128,  1,101, 80, 14, 69, 80, 30,133, 64,165,
-		 36, 70,  0,202,160,  8, 10,129,240, 12,  0,229,177,162,103,122, 65, 80,120, 65,144,120, 65, 16,  1,190, 55,  0,  0, 16,  1, 33, 16, 12, 64, 80,  0, 65,  2,  4, 17, 16,132,  0,  0,  0,121, 24,  0,  0,
-		111,  0,  0,  0, 26,  3, 76,144, 70,  2, 19,196, 49, 32,195, 27, 67,129,147, 75,179, 11,163, 43, 75,  1,137,113,193,113,129,113,161,201,129,185,  1, 65,129,177,153,193,137, 49,147, 33,187, 73,217, 16,
-		  4, 19,  4,194,152, 32, 16,199,  6, 97, 32, 38,  8,  4,178, 65, 24, 12, 10,118,115, 19,  4, 34,217, 48, 32,  9, 49, 65,192, 42,  2, 19,  4, 66,217,128, 16, 11, 51, 16, 67,  3,108,  8,156, 13,  4,  0,
-		 60,192,  4, 33,179, 54,  4,209,  4, 65,  0, 72,180,133,165,185, 17,161, 42,194, 26,122,122,146, 34,154, 32, 20,208,  4,161,136, 54,  4,196,  4,161,144, 38,  8,196, 50, 65, 32,152, 13,130,182,109, 88,
-		136,202,186,176,107,200,136,139,219, 16, 12, 19,132, 98,218, 32,104,218,134,101,168,172,203,187,134,111,184,192, 96,130, 64, 52, 27,  2, 49,152, 32, 20,212,  4,129,112, 54,  8, 90, 25,108, 88,196,160,
-		178,174, 49,184,  6, 50, 16,131,203, 12, 54,  4,218,134, 69,171,172, 11, 13,174, 33,211, 46,110,  3,209,133,193, 25,164,  1,151, 41,171, 47,168,183,185, 52,186,180, 55,183, 13, 11,177,  6, 86,134,145,
-		193, 64,  6,196,101,  6, 27,150,161,178, 46,236, 27,190,225,  2,  3, 22, 67, 79, 76, 79, 82, 27, 22, 49,112,  3,235,194,190,129, 12,196,224, 50,131, 13,139, 86, 89,151,247, 13,153,118,113, 19,  4,226,
-		217,176,196, 65,101, 93, 99,240, 13, 89, 28, 92,220,134,130, 13,218,224, 13,224, 64, 14, 54, 12,106, 48,  7,192,134, 98,162,232,  0,  2,170,176,177,217,181,185,164,145,149,185,209, 77,  9,130, 42,100,
-		120, 46,118,101,114,115,105,111,110, 83,  2,162,  9, 25,158,139, 93, 24,155, 93,153,220,148,192,168, 67,134,231, 50,135, 22, 70, 86, 38,215,244, 70, 86,198, 54, 37, 72,202,144,225,185,200,149,205,189,
-		213,201,141,149,205, 77,  9,158, 58,100,120, 46,118,105,101,119, 73,100, 83,116, 97,116,101, 83,130,168, 14, 25,158, 75,153, 27,157, 92, 30,212, 91,154, 27,221,220,148,128, 14,  0,  0,  0,  0,121, 24,
-		  0,  0, 81,  0,  0,  0, 51,  8,128, 28,196,225, 28,102, 20,  1, 61,136, 67, 56,132,195,140, 66,128,  7,121,120,  7,115,152,113, 12,230,  0, 15,237, 16, 14,244,128, 14, 51, 12, 66, 30,194,193, 29,206,
-		161, 28,102, 48,  5, 61,136, 67, 56,132,131, 27,204,  3, 61,200, 67, 61,140,  3, 61,204,120,140,116,112,  7,123,  8,  7,121, 72,135,112,112,  7,122,112,  3,118,120,135,112, 32,135, 25,204, 17, 14,236,
-		144, 14,225, 48, 15,110, 48, 15,227,240, 14,240, 80, 14, 51, 16,196, 29,222, 33, 28,216, 33, 29,194, 97, 30,102, 48,137, 59,188,131, 59,208, 67, 57,180,  3, 60,188,131, 60,132,  3, 59,204,240, 20,118,
-		 96,  7,123,104,  7, 55,104,135,114,104,  7, 55,128,135,112,144,135,112, 96,  7,118, 40,  7,118,248,  5,118,120,135,119,128,135, 95,  8,135,113, 24,135,114,152,135,121,152,129, 44,238,240, 14,238,224,
-		 14,245,192, 14,236, 48,  3, 98,200,161, 28,228,161, 28,204,161, 28,228,161, 28,220, 97, 28,202, 33, 28,196,129, 29,202, 97,  6,214,144, 67, 57,200, 67, 57,152, 67, 57,200, 67, 57,184,195, 56,148, 67,
-		 56,136,  3, 59,148,195, 47,188,131, 60,252,130, 59,212,  3, 59,176,195,140,200, 33,  7,124,112,  3,114, 16,135,115,112,  3,123,  8,  7,121, 96,135,112,200,135,119,168,  7,122,152,129, 60,228,128, 15,
-		110, 64, 15,229,208, 14,240, 48,131,129,200,  1, 31,220, 64, 28,228,161, 28,194, 97, 29,220, 64, 28,228,  1,  0,  0,  0,113, 32,  0,  0, 24,  0,  0,  0, 54,176, 13,151,239, 60,190, 16, 80, 69, 65, 68,
-		165,  3, 12, 37, 97,  0,  2,230, 23,183,109,  5,210,112,249,206,227, 11, 17,  1, 76, 68,  8, 52,195, 66, 88,192, 52, 92,190,243,248,139,  3, 12, 98,243, 80,147, 95,220,182,  9, 84,195,229, 59,143, 47,
-		 77, 78, 68,160,212,244, 80,147, 95,220,182, 17, 72,195,229, 59,143, 63, 17,209,132,  0, 17,230, 23,183,109,  0,  4,  3, 32, 13,  0,  0, 97, 32,  0,  0,189,  0,  0,  0, 19,  4, 67, 44, 16,  0,  0,  0,
-		  8,  0,  0,  0, 20, 71,  0,168,148,  0,145, 82,152,  1, 40,174,178, 43, 57, 26, 99,  4, 32,  8,130,248, 55, 70,  0,130, 32, 40,130,  3,  0,  0, 35,  6,  9,  0,130, 96, 32,109, 67,147,101,201,136, 65,
-		  2,128, 32, 24, 24, 96, 32, 89, 26,116,140, 24, 36,  0,  8,130,129, 17,  6,211,181, 41,200,136, 65,  2,128, 32, 24, 24, 98, 64, 97, 28,148,140, 24, 36,  0,  8,130,129, 49,  6,213,213, 77,202,136, 65,
-		  2,128, 32, 24, 24,100, 96, 97, 94,179,140, 24, 36,  0,  8,130,129, 81,  6, 87,246, 77,204,136, 65,  2,128, 32, 24, 24,102,128,105, 96, 80, 53, 35,  6,  9,  0,130, 96, 96,156, 65, 38,  6, 97,112, 57,
-		 35,  6,  9,  0,130, 96, 96,160,129, 54,  6, 98, 16, 61, 35,  6,  9,  0,130, 96, 96,164,193, 54,  6, 99,144, 65, 35,  6,  9,  0,130, 96, 96,168,  1, 71,  6,100, 48, 69, 35,  6,  9,  0,130, 96, 96,172,
-		 65, 87,  6,101,144, 73,195, 17,133, 67,124,195, 17,197, 67,124, 37,  4, 59,203, 32,  4,193,136,193,  1,128, 32, 24, 52,109, 64, 65,105, 48,154, 16,  0,163,  9, 66, 48,154, 48,  8,163,  9,196, 48, 98,
-		112,  0, 32,  8,  6,141, 28,100,213, 27,140, 38,  4,192,104,130, 16,140, 38, 12,194,104,  2, 49,140, 24, 28,  0,  8,130, 65,115,  7,158,214,  6,163,  9,  1, 48,154, 32,  4,163,  9,131, 48,154, 64, 12,
-		 35,  6,  7,  0,130, 96,208,240,193, 24,124,116, 48,154, 16,  0,163,  9, 66, 48,154, 48,  8,163,  9,196, 96,147, 38,159, 17,  3,  4,  0, 65, 48,120, 66, 65, 13, 30, 45, 24, 49, 64,  0, 16,  4,131, 71,
-		 20,214, 96,209,  2, 11, 14,232,152,229,201,103,196,  0,  1, 64, 16, 12,158, 82,112,  3,201, 11, 70, 12, 16,  0,  4,193,224, 49,133, 55,112,188,192,  2,  5, 58,150,137,129,124, 70, 12, 16,  0,  4,193,
-		224, 73,  5, 57,168,196, 32, 24, 49, 64,  0, 16,  4,131, 71, 21,230, 32, 18,131,192,130,  6, 58,198,153,129,124, 70, 12, 16,  0,  4,193,224,105,  5, 59,192,204, 32, 24, 49, 64,  0, 16,  4,131,199, 21,
-		238,128, 50,131,192,  2,  8, 58,179,  4,194, 64,197,160,  5,180,  0, 12, 84, 12, 84, 64, 11,192, 64,197,224,  4,180,  0, 12, 84, 12, 72, 32, 15,192,136, 65,  2,128, 32, 24, 32,182,240,  7,177, 16, 11,
-		167, 64,140, 24, 36,  0,  8,130,  1, 98, 11,127, 16, 11,177,  0, 10,195,136, 65,  2,128, 32, 24, 32,182,240,  7,177, 16, 11,165, 32,140, 24, 36,  0,  8,130,  1, 98, 11,127, 16, 11,177, 96, 10,193,136,
-		 65,  2,128, 32, 24, 32,182,240,  7,178, 16, 11,167,  0,  7, 35,  6,  9,  0,130, 96,128,216,194, 31,200, 66, 44,128,194, 27,140, 24, 36,  0,  8,130,  1, 98, 11,127,176, 10,177,112, 10,116, 48, 98,144,
-		  0, 32,  8,  6,136, 45,252,193, 42,196,  2, 40,204,193,136, 65,  2,128, 32, 24, 32,182,240,  7,171, 16, 11,165, 32,  7, 35,  6,  9,  0,130, 96,128,216,194, 31,172, 66, 44,152, 66, 28,140, 24, 36,  0,
-		  8,130,  1, 98, 11,127,208, 10,177,112, 10,119, 48, 98,144,  0, 32,  8,  6,136, 45,252, 65, 43,196,  2, 40,216,193,136, 65,  2,128, 32, 24, 32,182,240,  7,173, 16, 11,165, 80,  7, 35,  6,  9,  0,130,
-		 96,128,216,194, 31,164, 66, 44,156,130, 27,140, 24, 36,  0,  8,130,  1, 98, 11,127,144, 10,177,  0, 10,109, 48, 98,144,  0, 32,  8,  6,136, 45,252, 65, 42,196, 66, 41,176,  1,  2,  0,  0,  0,  0,  0,
-		  0,  0,
-	};
-
-	constexpr std::array<uint8_t, 1820> ShaderVsSpirvBytes{
-		  3,  2, 35,  7,  0,  5,  1,  0,  0,  0, 14,  0, 62,  0,  0,  0,  0,  0,  0,  0, 17,  0,  2,  0,  1,  0,  0,  0, 14,  0,  3,  0,  0,  0,  0,  0,  1,  0,  0,  0, 15,  0, 15,  0,  0,  0,  0,  0,  1,  0,
-		  0,  0,109, 97,105,110,  0,  0,  0,  0,  2,  0,  0,  0,  3,  0,  0,  0,  4,  0,  0,  0,  5,  0,  0,  0,  6,  0,  0,  0,  7,  0,  0,  0,  8,  0,  0,  0,  9,  0,  0,  0, 10,  0,  0,  0, 11,  0,  0,  0,
-		  3,  0,  3,  0,  5,  0,  0,  0, 88,  2,  0,  0,  5,  0,  7,  0, 12,  0,  0,  0,116,121,112,101, 46, 86,101,114,116,101,120, 85,110,105,102,111,114,109,115,  0,  6,  0,  8,  0, 12,  0,  0,  0,  0,  0,
-		  0,  0,112,114,111,106,101, 99,116,105,111,110, 77, 97,116,114,105,120,  0,  0,  0,  0,  5,  0,  6,  0, 11,  0,  0,  0, 86,101,114,116,101,120, 85,110,105,102,111,114,109,115,  0,  0,  5,  0,  7,  0,
-		  2,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 48,  0,  0,  0,  0,  5,  0,  7,  0,  3,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 49,  0,  0,
-		  0,  0,  5,  0,  7,  0,  4,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 50,  0,  0,  0,  0,  5,  0,  7,  0,  5,  0,  0,  0,105,110, 46,118, 97,114, 46, 84, 69, 88, 67, 79,
-		 79, 82, 68, 51,  0,  0,  0,  0,  5,  0,  7,  0,  7,  0,  0,  0,111,117,116, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 48,  0,  0,  0,  5,  0,  6,  0,  8,  0,  0,  0,111,117,116, 46,118, 97,
-		114, 46, 67, 79, 76, 79, 82, 48,  0,  0,  5,  0,  7,  0,  9,  0,  0,  0,111,117,116, 46,118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 49,  0,  0,  0,  5,  0,  7,  0, 10,  0,  0,  0,111,117,116, 46,
-		118, 97,114, 46, 84, 69, 88, 67, 79, 79, 82, 68, 50,  0,  0,  0,  5,  0,  4,  0,  1,  0,  0,  0,109, 97,105,110,  0,  0,  0,  0, 71,  0,  4,  0,  6,  0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0, 71,  0,
-		  4,  0,  2,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 71,  0,  4,  0,  3,  0,  0,  0, 30,  0,  0,  0,  1,  0,  0,  0, 71,  0,  4,  0,  4,  0,  0,  0, 30,  0,  0,  0,  2,  0,  0,  0, 71,  0,  4,  0,
-		  5,  0,  0,  0, 30,  0,  0,  0,  3,  0,  0,  0, 71,  0,  4,  0,  7,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0, 71,  0,  4,  0,  8,  0,  0,  0, 30,  0,  0,  0,  1,  0,  0,  0, 71,  0,  4,  0,  9,  0,
-		  0,  0, 30,  0,  0,  0,  2,  0,  0,  0, 71,  0,  4,  0, 10,  0,  0,  0, 30,  0,  0,  0,  3,  0,  0,  0, 71,  0,  4,  0, 11,  0,  0,  0, 34,  0,  0,  0,  1,  0,  0,  0, 71,  0,  4,  0, 11,  0,  0,  0,
-		 33,  0,  0,  0,  0,  0,  0,  0, 72,  0,  5,  0, 12,  0,  0,  0,  0,  0,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 72,  0,  5,  0, 12,  0,  0,  0,  0,  0,  0,  0,  7,  0,  0,  0, 16,  0,  0,  0, 72,  0,
-		  4,  0, 12,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0, 71,  0,  3,  0, 12,  0,  0,  0,  2,  0,  0,  0, 21,  0,  4,  0, 13,  0,  0,  0, 32,  0,  0,  0,  1,  0,  0,  0, 43,  0,  4,  0, 13,  0,  0,  0,
-		 14,  0,  0,  0,  0,  0,  0,  0, 22,  0,  3,  0, 15,  0,  0,  0, 32,  0,  0,  0, 43,  0,  4,  0, 15,  0,  0,  0, 16,  0,  0,  0,  0,  0, 32,192, 20,  0,  2,  0, 17,  0,  0,  0, 41,  0,  3,  0, 17,  0,
-		  0,  0, 18,  0,  0,  0, 43,  0,  4,  0, 15,  0,  0,  0, 19,  0,  0,  0,  0,  0,128, 63, 23,  0,  4,  0, 20,  0,  0,  0, 15,  0,  0,  0,  4,  0,  0,  0, 24,  0,  4,  0, 21,  0,  0,  0, 20,  0,  0,  0,
-		  4,  0,  0,  0, 30,  0,  3,  0, 12,  0,  0,  0, 21,  0,  0,  0, 32,  0,  4,  0, 22,  0,  0,  0,  2,  0,  0,  0, 12,  0,  0,  0, 23,  0,  4,  0, 23,  0,  0,  0, 15,  0,  0,  0,  3,  0,  0,  0, 32,  0,
-		  4,  0, 24,  0,  0,  0,  1,  0,  0,  0, 23,  0,  0,  0, 23,  0,  4,  0, 25,  0,  0,  0, 15,  0,  0,  0,  2,  0,  0,  0, 32,  0,  4,  0, 26,  0,  0,  0,  1,  0,  0,  0, 25,  0,  0,  0, 32,  0,  4,  0,
-		 27,  0,  0,  0,  1,  0,  0,  0, 20,  0,  0,  0, 32,  0,  4,  0, 28,  0,  0,  0,  3,  0,  0,  0, 20,  0,  0,  0, 32,  0,  4,  0, 29,  0,  0,  0,  3,  0,  0,  0, 25,  0,  0,  0, 32,  0,  4,  0, 30,  0,
-		  0,  0,  3,  0,  0,  0, 23,  0,  0,  0, 19,  0,  2,  0, 31,  0,  0,  0, 33,  0,  3,  0, 32,  0,  0,  0, 31,  0,  0,  0, 32,  0,  4,  0, 33,  0,  0,  0,  2,  0,  0,  0, 21,  0,  0,  0, 59,  0,  4,  0,
-		 22,  0,  0,  0, 11,  0,  0,  0,  2,  0,  0,  0, 59,  0,  4,  0, 24,  0,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 26,  0,  0,  0,  3,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 27,  0,
-		  0,  0,  4,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 24,  0,  0,  0,  5,  0,  0,  0,  1,  0,  0,  0, 59,  0,  4,  0, 28,  0,  0,  0,  6,  0,  0,  0,  3,  0,  0,  0, 59,  0,  4,  0, 29,  0,  0,  0,
-		  7,  0,  0,  0,  3,  0,  0,  0, 59,  0,  4,  0, 28,  0,  0,  0,  8,  0,  0,  0,  3,  0,  0,  0, 59,  0,  4,  0, 30,  0,  0,  0,  9,  0,  0,  0,  3,  0,  0,  0, 59,  0,  4,  0, 30,  0,  0,  0, 10,  0,
-		  0,  0,  3,  0,  0,  0, 54,  0,  5,  0, 31,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 32,  0,  0,  0,248,  0,  2,  0, 34,  0,  0,  0, 61,  0,  4,  0, 23,  0,  0,  0, 35,  0,  0,  0,  2,  0,  0,  0,
-		 61,  0,  4,  0, 25,  0,  0,  0, 36,  0,  0,  0,  3,  0,  0,  0, 61,  0,  4,  0, 20,  0,  0,  0, 37,  0,  0,  0,  4,  0,  0,  0, 61,  0,  4,  0, 23,  0,  0,  0, 38,  0,  0,  0,  5,  0,  0,  0, 81,  0,
-		  5,  0, 15,  0,  0,  0, 39,  0,  0,  0, 36,  0,  0,  0,  0,  0,  0,  0,184,  0,  5,  0, 17,  0,  0,  0, 40,  0,  0,  0, 39,  0,  0,  0, 16,  0,  0,  0,168,  0,  4,  0, 17,  0,  0,  0, 41,  0,  0,  0,
-		 40,  0,  0,  0,247,  0,  3,  0, 42,  0,  0,  0,  0,  0,  0,  0,250,  0,  4,  0, 41,  0,  0,  0, 43,  0,  0,  0, 42,  0,  0,  0,248,  0,  2,  0, 43,  0,  0,  0, 81,  0,  5,  0, 15,  0,  0,  0, 44,  0,
-		  0,  0, 36,  0,  0,  0,  1,  0,  0,  0,184,  0,  5,  0, 17,  0,  0,  0, 45,  0,  0,  0, 44,  0,  0,  0, 16,  0,  0,  0,249,  0,  2,  0, 42,  0,  0,  0,248,  0,  2,  0, 42,  0,  0,  0,245,  0,  7,  0,
-		 17,  0,  0,  0, 46,  0,  0,  0, 18,  0,  0,  0, 34,  0,  0,  0, 45,  0,  0,  0, 43,  0,  0,  0,247,  0,  3,  0, 47,  0,  0,  0,  0,  0,  0,  0,250,  0,  4,  0, 46,  0,  0,  0, 48,  0,  0,  0, 49,  0,
-		  0,  0,248,  0,  2,  0, 48,  0,  0,  0, 81,  0,  5,  0, 15,  0,  0,  0, 50,  0,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 15,  0,  0,  0, 51,  0,  0,  0, 35,  0,  0,  0,  1,  0,  0,  0,
-		 81,  0,  5,  0, 15,  0,  0,  0, 52,  0,  0,  0, 35,  0,  0,  0,  2,  0,  0,  0, 80,  0,  7,  0, 20,  0,  0,  0, 53,  0,  0,  0, 50,  0,  0,  0, 51,  0,  0,  0, 52,  0,  0,  0, 19,  0,  0,  0,249,  0,
-		  2,  0, 47,  0,  0,  0,248,  0,  2,  0, 49,  0,  0,  0, 65,  0,  5,  0, 33,  0,  0,  0, 54,  0,  0,  0, 11,  0,  0,  0, 14,  0,  0,  0, 61,  0,  4,  0, 21,  0,  0,  0, 55,  0,  0,  0, 54,  0,  0,  0,
-		 81,  0,  5,  0, 15,  0,  0,  0, 56,  0,  0,  0, 35,  0,  0,  0,  0,  0,  0,  0, 81,  0,  5,  0, 15,  0,  0,  0, 57,  0,  0,  0, 35,  0,  0,  0,  1,  0,  0,  0, 81,  0,  5,  0, 15,  0,  0,  0, 58,  0,
-		  0,  0, 35,  0,  0,  0,  2,  0,  0,  0, 80,  0,  7,  0, 20,  0,  0,  0, 59,  0,  0,  0, 56,  0,  0,  0, 57,  0,  0,  0, 58,  0,  0,  0, 19,  0,  0,  0,144,  0,  5,  0, 20,  0,  0,  0, 60,  0,  0,  0,
-		 59,  0,  0,  0, 55,  0,  0,  0,249,  0,  2,  0, 47,  0,  0,  0,248,  0,  2,  0, 47,  0,  0,  0,245,  0,  7,  0, 20,  0,  0,  0, 61,  0,  0,  0, 53,  0,  0,  0, 48,  0,  0,  0, 60,  0,  0,  0, 49,  0,
-		  0,  0, 62,  0,  3,  0,  6,  0,  0,  0, 61,  0,  0,  0, 62,  0,  3,  0,  7,  0,  0,  0, 36,  0,  0,  0, 62,  0,  3,  0,  8,  0,  0,  0, 37,  0,  0,  0, 62,  0,  3,  0,  9,  0,  0,  0, 38,  0,  0,  0,
-		 62,  0,  3,  0, 10,  0,  0,  0, 35,  0,  0,  0,253,  0,  1,  0, 56,  0,  1,  0,
-	};
-
-}
-
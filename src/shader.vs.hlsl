@@ -1,8 +1,19 @@
+#include "vertex.hlsli"
+
 cbuffer VertexUniforms : register(b0, space1)
 {
     float4x4 projectionMatrix;
 };
 
+cbuffer DrawUniforms : register(b1, space1)
+{
+    uint transformOffset; // Added to the transform index of the vertex.
+};
+
+// Model matrices of the frame, index 0 is the identity.
+StructuredBuffer<float4x4> Transforms : register(t0, space0);
+
+#ifdef ROBOT_LEGACY_VERTEX
 struct VSInput
 {
     float3 position : TEXCOORD0;
@@ -11,30 +22,53 @@ struct VSInput
     float3 normal   : TEXCOORD3;
 };
 
-struct VSOutput
+float3 getNormal(VSInput input)
+{
+    return input.normal;
+}
+
+uint getTransformIndex(VSInput input)
+{
+    return 0; // Transformed on the CPU.
+}
+#else
+struct VSInput
 {
-    float4 position : SV_Position;
-    float2 tex      : TEXCOORD0;
-    float4 color    : COLOR0;
-    float3 normal   : TEXCOORD1;
-    float3 worldPos : TEXCOORD2;
+    float3 position : TEXCOORD0;
+    float4 color    : TEXCOORD1; // RGBA8
+    float2 normal   : TEXCOORD2; // Octahedral, snorm16
+    float2 tex      : TEXCOORD3; // Half floats
+    uint flags      : TEXCOORD4;
 };
 
+uint getTransformIndex(VSInput input)
+{
+    return input.flags >> VERTEX_TRANSFORM_SHIFT;
+}
+
+float3 getNormal(VSInput input)
+{
+    return decodeOctahedral(input.normal);
+}
+#endif
+
 VSOutput main(VSInput input)
 {
     VSOutput output;
-    if (input.tex.x < -2.5 || input.tex.y < -2.5)
-    {
-        output.position = float4(input.position, 1.0f);
-    }
-    else
-    {
-        output.position = mul(projectionMatrix, float4(input.position, 1.0f));
-    }
+#ifdef ROBOT_SHADER_CLIP_SPACE
+    // Already in clip space, drawn unlit.
+    output.position = float4(input.position, 1.0f);
+    output.worldPos = input.position;
+    output.normal = getNormal(input);
+#else
+    float4x4 model = Transforms[transformOffset + getTransformIndex(input)];
+    float4 worldPos = mul(model, float4(input.position, 1.0f));
+    output.position = mul(projectionMatrix, worldPos);
+    output.worldPos = worldPos.xyz;
+    output.normal = mul(model, float4(getNormal(input), 0.0f)).xyz;
+#endif
 
     output.tex = input.tex;
     output.color = input.color;
-    output.worldPos = input.position;
-    output.normal = input.normal;
     return output;
 }
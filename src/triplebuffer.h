@@ -0,0 +1,79 @@
+#ifndef ROBOT_TRIPLEBUFFER_H
+#define ROBOT_TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace robot {
+
+	/// Lock-free handoff of the latest value from one writer thread to one reader thread.
+	/// The writer never waits for the reader and the reader always gets the latest
+	/// complete value. Values published between two reads are dropped.
+	template <typename T>
+	class TripleBuffer {
+	public:
+		TripleBuffer() = default;
+
+		explicit TripleBuffer(const T& value)
+			: buffers_{Slot{value}, Slot{value}, Slot{value}} {
+		}
+
+		/// Writer thread. Returns the buffer to fill before calling publish.
+		T& getWriteBuffer() {
+			return buffers_[writeIndex_].value;
+		}
+
+		/// Writer thread. Makes the write buffer the latest value.
+		void publish() {
+			auto old = middle_.exchange(writeIndex_ | DirtyBit, std::memory_order_acq_rel);
+			writeIndex_ = old & IndexMask;
+		}
+
+		/// Writer thread.
+		void write(const T& value) {
+			getWriteBuffer() = value;
+			publish();
+		}
+
+		/// Reader thread. Fetches the latest published value, returns false if nothing
+		/// new was published since the last call.
+		bool update() {
+			if ((middle_.load(std::memory_order_relaxed) & DirtyBit) == 0) {
+				return false;
+			}
+			auto old = middle_.exchange(readIndex_, std::memory_order_acq_rel);
+			readIndex_ = old & IndexMask;
+			return true;
+		}
+
+		/// Reader thread. Returns the value fetched by the last update call.
+		const T& getReadBuffer() const {
+			return buffers_[readIndex_].value;
+		}
+
+		/// Reader thread.
+		const T& read() {
+			update();
+			return getReadBuffer();
+		}
+
+	private:
+		static constexpr uint8_t IndexMask = 0b011;
+		static constexpr uint8_t DirtyBit = 0b100;
+
+		// One cache line each, to avoid false sharing between the threads.
+		struct alignas(64) Slot {
+			T value{};
+		};
+
+		std::array<Slot, 3> buffers_;
+		alignas(64) std::atomic<uint8_t> middle_ = 1;
+		alignas(64) uint8_t writeIndex_ = 0;
+		alignas(64) uint8_t readIndex_ = 2;
+	};
+
+}
+
+#endif
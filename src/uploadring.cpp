@@ -0,0 +1,160 @@
+#include "uploadring.h"
+
+#include <sdl/sdlexception.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace robot {
+
+	UploadRing::UploadRing(size_t capacity)
+		: ring_{capacity} {
+	}
+
+	UploadRing::~UploadRing() {
+		if (gpuDevice_ == nullptr) {
+			return;
+		}
+		while (ring_.framesInFlight() > 0) {
+			waitForOldestFrame();
+		}
+		release();
+	}
+
+	void UploadRing::beginFrame(SDL_GPUDevice* gpuDevice) {
+		gpuDevice_ = gpuDevice;
+		retireFinishedFrames();
+		while (ring_.framesInFlight() >= FramesInFlight) {
+			waitForOldestFrame();
+		}
+		stats_.uploadedBytes = 0;
+		map();
+	}
+
+	void UploadRing::endFrame() {
+		submit();
+		stats_.framesInFlight = ring_.framesInFlight();
+		stats_.used = ring_.used();
+	}
+
+	void UploadRing::uploadBytes(std::span<const std::byte> data, SDL_GPUBuffer* buffer, bool cycle, Uint32 offset) {
+		if (data.empty()) {
+			return;
+		}
+		const size_t ringOffset = allocate(data.size());
+		std::memcpy(mapped_ + ringOffset, data.data(), data.size());
+		uploads_.push_back(Upload{
+			.ringOffset = static_cast<Uint32>(ringOffset),
+			.size = static_cast<Uint32>(data.size()),
+			.buffer = buffer,
+			.offset = offset,
+			.cycle = cycle
+		});
+		stats_.uploadedBytes += data.size();
+		stats_.peakUsed = std::max(stats_.peakUsed, ring_.used());
+	}
+
+	size_t UploadRing::allocate(size_t size) {
+		while (true) {
+			const size_t offset = ring_.allocate(size);
+			if (offset != RingAllocator::NoSpace) {
+				return offset;
+			}
+			if (!uploads_.empty()) {
+				// Does the uploads so far, the frame continues in the space left.
+				submit();
+				map();
+			} else if (ring_.framesInFlight() > 0) {
+				waitForOldestFrame();
+			} else {
+				// Larger than the ring, grows to fit.
+				release();
+				ring_.resize(std::max(2 * ring_.capacity(), size));
+				map();
+			}
+		}
+	}
+
+	void UploadRing::submit() {
+		if (transferBuffer_ != nullptr && mapped_ != nullptr) {
+			SDL_UnmapGPUTransferBuffer(gpuDevice_, transferBuffer_);
+			mapped_ = nullptr;
+		}
+		if (uploads_.empty()) {
+			return;
+		}
+		if (ring_.framesInFlight() == RingAllocator::MaxFrames) {
+			waitForOldestFrame();
+		}
+
+		SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(gpuDevice_);
+		SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+		for (const auto& upload : uploads_) {
+			SDL_GPUTransferBufferLocation location{
+				.transfer_buffer = transferBuffer_,
+				.offset = upload.ringOffset
+			};
+			SDL_GPUBufferRegion region{
+				.buffer = upload.buffer,
+				.offset = upload.offset,
+				.size = upload.size
+			};
+			SDL_UploadToGPUBuffer(copyPass, &location, &region, upload.cycle);
+		}
+		SDL_EndGPUCopyPass(copyPass);
+		uploads_.clear();
+
+		fences_[(firstFence_ + ring_.framesInFlight()) % fences_.size()] = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+		ring_.endFrame();
+	}
+
+	void UploadRing::retireFinishedFrames() {
+		while (ring_.framesInFlight() > 0 && SDL_QueryGPUFence(gpuDevice_, fences_[firstFence_])) {
+			SDL_ReleaseGPUFence(gpuDevice_, fences_[firstFence_]);
+			firstFence_ = (firstFence_ + 1) % fences_.size();
+			ring_.retireFrame();
+		}
+	}
+
+	void UploadRing::waitForOldestFrame() {
+		SDL_GPUFence* fence = fences_[firstFence_];
+		if (!SDL_QueryGPUFence(gpuDevice_, fence)) {
+			++stats_.stalls;
+			SDL_WaitForGPUFences(gpuDevice_, true, &fence, 1);
+		}
+		SDL_ReleaseGPUFence(gpuDevice_, fence);
+		firstFence_ = (firstFence_ + 1) % fences_.size();
+		ring_.retireFrame();
+	}
+
+	void UploadRing::map() {
+		if (transferBuffer_ == nullptr) {
+			SDL_GPUTransferBufferCreateInfo createInfo{
+				.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+				.size = static_cast<Uint32>(ring_.capacity())
+			};
+			transferBuffer_ = SDL_CreateGPUTransferBuffer(gpuDevice_, &createInfo);
+			if (transferBuffer_ == nullptr) {
+				throw sdl::SdlException("[UploadRing] Failed to create the transfer buffer");
+			}
+			stats_.capacity = ring_.capacity();
+		}
+		// Not cycled, the fences keep the frames in flight apart.
+		mapped_ = static_cast<std::byte*>(SDL_MapGPUTransferBuffer(gpuDevice_, transferBuffer_, false));
+		if (mapped_ == nullptr) {
+			throw sdl::SdlException("[UploadRing] Failed to map the transfer buffer");
+		}
+	}
+
+	void UploadRing::release() {
+		if (mapped_ != nullptr) {
+			SDL_UnmapGPUTransferBuffer(gpuDevice_, transferBuffer_);
+			mapped_ = nullptr;
+		}
+		if (transferBuffer_ != nullptr) {
+			SDL_ReleaseGPUTransferBuffer(gpuDevice_, transferBuffer_);
+			transferBuffer_ = nullptr;
+		}
+	}
+
+}
@@ -0,0 +1,91 @@
+#ifndef ROBOT_UPLOADRING_H
+#define ROBOT_UPLOADRING_H
+
+#include "ringallocator.h"
+
+#include <SDL3/SDL_gpu.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace robot {
+
+	struct UploadRingStats {
+		size_t capacity = 0;
+		size_t used = 0;		// Bytes held by the uploads in flight.
+		size_t peakUsed = 0;
+		size_t framesInFlight = 0;
+		size_t uploadedBytes = 0;	// In the last frame.
+		size_t stalls = 0;		// Waits on the GPU for a free frame or free space, in total.
+	};
+
+	/// One persistent transfer buffer shared by all uploads of the frames in flight.
+	/// The uploads of a frame are copied into it, suballocated by a RingAllocator, and
+	/// done in one copy pass on a command buffer of its own, submitted with a fence.
+	/// The space of a frame is reused when its fence is signaled.
+	class UploadRing {
+	public:
+		static constexpr size_t FramesInFlight = 3;
+
+		explicit UploadRing(size_t capacity = 4 * 1024 * 1024);
+
+		~UploadRing();
+
+		UploadRing(const UploadRing&) = delete;
+		UploadRing& operator=(const UploadRing&) = delete;
+
+		/// Waits, if FramesInFlight frames are still on the GPU, for the oldest one.
+		void beginFrame(SDL_GPUDevice* gpuDevice);
+
+		/// Copies the data to the ring, uploaded to the buffer at the byte offset by endFrame.
+		/// Cycle only when the whole buffer is uploaded, the earlier contents are discarded.
+		template <typename T>
+		void upload(std::span<const T> data, SDL_GPUBuffer* buffer, bool cycle, Uint32 offset = 0) {
+			uploadBytes(std::as_bytes(data), buffer, cycle, offset);
+		}
+
+		/// Submits the uploads of the frame, before the command buffer that uses them.
+		void endFrame();
+
+		const UploadRingStats& getStats() const {
+			return stats_;
+		}
+
+	private:
+		struct Upload {
+			Uint32 ringOffset;
+			Uint32 size;
+			SDL_GPUBuffer* buffer;
+			Uint32 offset;
+			bool cycle;
+		};
+
+		void uploadBytes(std::span<const std::byte> data, SDL_GPUBuffer* buffer, bool cycle, Uint32 offset);
+
+		size_t allocate(size_t size);
+
+		void submit();
+
+		void retireFinishedFrames();
+
+		void waitForOldestFrame();
+
+		void map();
+
+		void release();
+
+		SDL_GPUDevice* gpuDevice_ = nullptr;
+		SDL_GPUTransferBuffer* transferBuffer_ = nullptr;
+		std::byte* mapped_ = nullptr;
+		RingAllocator ring_;
+		std::vector<Upload> uploads_;	// Of the current frame.
+		std::array<SDL_GPUFence*, RingAllocator::MaxFrames> fences_{};	// Same order as the ring frames.
+		size_t firstFence_ = 0;
+		UploadRingStats stats_;
+	};
+
+}
+
+#endif
@@ -0,0 +1,22 @@
+// Shared by all shaders, must match VertexFlag in shader.h. The bits below are only
+// used on the CPU to select the shader variant.
+#define VERTEX_TRANSFORM_SHIFT 8 // The bits above are the transform index.
+
+struct VSOutput
+{
+    float4 position : SV_Position;
+    float2 tex      : TEXCOORD0;
+    float4 color    : COLOR0;
+    float3 normal   : TEXCOORD1;
+    float3 worldPos : TEXCOORD2;
+};
+
+// Inverse of encodeOctahedral in shader.h.
+float3 decodeOctahedral(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}